@@ -13,16 +13,20 @@
 #define oled_enable()			nrf_gpio_pin_write(OLED_ENABLE_PIN, GPIO_PIN_SET)
 #define oled_disable()			nrf_gpio_pin_write(OLED_ENABLE_PIN, GPIO_PIN_RESET)
 
-#define oled_write_string(string, x, y) ssd1309_SetCursor(x, y);                              \
-                                        ssd1309_WriteString(string, Font_7x10, White)
+#define oled_write_string(string, x, y) ssd1309_SetCursor(&m_oled, x, y);                     \
+                                        ssd1309_WriteString(&m_oled, string, Font_7x10, White)
 
-#define oled_write_mstring(string, x, y) ssd1309_SetCursor(x, y);			      \
-                                         ssd1309_WriteString(string, Font_11x18, White)
+#define oled_write_mstring(string, x, y) ssd1309_SetCursor(&m_oled, x, y);		      \
+                                         ssd1309_WriteString(&m_oled, string, Font_11x18, White)
 
-#define oled_write_symbol(symbol, x, y) ssd1309_WriteSymbol(symbol, x, y)
+#define oled_write_symbol(symbol, x, y) ssd1309_WriteSymbol(&m_oled, symbol, x, y)
 
-#define oled_update_screen()		ssd1309_UpdateScreen()
-#define oled_clear_screen()		ssd1309_Fill(Black)
+#if SPI_USE_INTERRUPT
+#define oled_update_screen()		ssd1309_UpdateScreenAsync(&m_oled, NULL)
+#else
+#define oled_update_screen()		ssd1309_UpdateScreen(&m_oled)
+#endif
+#define oled_clear_screen()		ssd1309_Fill(&m_oled, Black)
 
 typedef enum
 {
@@ -139,15 +143,102 @@ const unsigned char github_logo_64x64[] =
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
+/* Page-major copies of the bitmaps above, made by tools/bmpconv.py */
+#include "example_bitmaps.h"
+
 /* SPI instances */
 const nrf_drv_spi_t m_oled_spi   = NRF_DRV_SPI_INSTANCE(OLED_SPI_INSTANCE);
 
+/* OLED instance and its screenbuffers */
+static SSD1309_t m_oled;
+static uint8_t m_oled_buffer[SSD1309_BUFFER_BYTES(SSD1309_WIDTH, SSD1309_HEIGHT)];
+#if SPI_USE_INTERRUPT
+static uint8_t m_oled_back_buffer[SSD1309_BUFFER_BYTES(SSD1309_WIDTH, SSD1309_HEIGHT)];
+#endif
+
 #if defined(SSD1309_USE_I2C)
 void i2c_oled_comm_handle(uint8_t hdl_address, uint8_t *hdl_buffer, size_t hdl_buffer_size)
 {
     nrf_drv_twi_tx(&m_oled_twi, hdl_address, hdl_buffer, hdl_buffer_size, false);
 }
 #elif defined(SSD1309_USE_SPI)
+/* nrf_drv_spi transfers at most 255 bytes at once */
+#define OLED_SPI_MAX_TRANSFER   255
+
+#if SPI_USE_INTERRUPT
+static volatile bool m_oled_spi_xfer_done = true;
+static volatile bool m_oled_spi_async = false;
+static uint8_t *m_oled_spi_async_buffer;
+static size_t m_oled_spi_async_remaining;
+
+/* Start the next chunk of the asynchronous transfer */
+static void spi_oled_async_next(void)
+{
+    uint8_t chunk = (m_oled_spi_async_remaining > OLED_SPI_MAX_TRANSFER) ? OLED_SPI_MAX_TRANSFER : m_oled_spi_async_remaining;
+
+    m_oled_spi_xfer_done = false;
+    APP_ERROR_CHECK(nrf_drv_spi_transfer(&m_oled_spi, m_oled_spi_async_buffer, chunk, NULL, 0));
+
+    m_oled_spi_async_buffer += chunk;
+    m_oled_spi_async_remaining -= chunk;
+}
+
+/* SPI event handler: completes blocking transfers and drives asynchronous updates */
+void oled_spi_callback(nrf_drv_spi_evt_t const *p_event, void *p_context)
+{
+    m_oled_spi_xfer_done = true;
+
+    if (m_oled_spi_async)
+    {
+        if (m_oled_spi_async_remaining > 0)
+        {
+            spi_oled_async_next();
+        }
+        else
+        {
+            m_oled_spi_async = false;
+            ssd1309_TransferDone(&m_oled);
+        }
+    }
+}
+
+/* Start a transfer of an asynchronous update and return, */
+/* oled_spi_callback reports its completion to the driver */
+void spi_oled_async_handle(uint8_t hdl_type, uint8_t *hdl_buffer, size_t hdl_buffer_size)
+{
+    nrf_gpio_pin_write(OLED_DC_PIN, (hdl_type == OLED_WRITE_DATA) ? GPIO_PIN_SET : GPIO_PIN_RESET);
+
+    m_oled_spi_async_buffer = hdl_buffer;
+    m_oled_spi_async_remaining = hdl_buffer_size;
+    m_oled_spi_async = true;
+    spi_oled_async_next();
+}
+#endif
+
+/* Blocking transfer of any length */
+static void spi_oled_transfer(uint8_t *hdl_buffer, size_t hdl_buffer_size)
+{
+    while (hdl_buffer_size > 0)
+    {
+        uint8_t chunk = (hdl_buffer_size > OLED_SPI_MAX_TRANSFER) ? OLED_SPI_MAX_TRANSFER : hdl_buffer_size;
+
+#if SPI_USE_INTERRUPT
+        m_oled_spi_xfer_done = false;
+        APP_ERROR_CHECK(nrf_drv_spi_transfer(&m_oled_spi, hdl_buffer, chunk, NULL, 0));
+
+        while (!m_oled_spi_xfer_done)
+        {
+            __WFE();
+        }
+#else
+        APP_ERROR_CHECK(nrf_drv_spi_transfer(&m_oled_spi, hdl_buffer, chunk, NULL, 0));
+#endif
+
+        hdl_buffer += chunk;
+        hdl_buffer_size -= chunk;
+    }
+}
+
 void spi_oled_comm_handle(uint8_t hdl_type, uint8_t *hdl_buffer, size_t hdl_buffer_size)
 {
     switch (hdl_type)
@@ -168,14 +259,14 @@ void spi_oled_comm_handle(uint8_t hdl_type, uint8_t *hdl_buffer, size_t hdl_buff
         case OLED_WRITE_COMMAND:
         {
             nrf_gpio_pin_write(OLED_DC_PIN, GPIO_PIN_RESET); 
-            APP_ERROR_CHECK(nrf_drv_spi_transfer(&m_oled_spi, hdl_buffer, hdl_buffer_size, NULL, NULL));
+            spi_oled_transfer(hdl_buffer, hdl_buffer_size);
             break;
         }
 
         case OLED_WRITE_DATA:
         {
             nrf_gpio_pin_write(OLED_DC_PIN, GPIO_PIN_SET); 
-            APP_ERROR_CHECK(nrf_drv_spi_transfer(&m_oled_spi, hdl_buffer, hdl_buffer_size, NULL, NULL));
+            spi_oled_transfer(hdl_buffer, hdl_buffer_size);
             break;
         }
 
@@ -197,7 +288,7 @@ void spi_init(void)
 #endif
 
 #if SPI_USE_INTERRUPT
-    APP_ERROR_CHECK(nrf_drv_spi_init(&m_oled_spi, &spi_config, oled_spi_callback, NULL));
+    APP_ERROR_CHECK(nrf_drv_spi_init(&m_oled_spi, &oled_spi_config, oled_spi_callback, NULL));
 #else
     APP_ERROR_CHECK(nrf_drv_spi_init(&m_oled_spi, &oled_spi_config, NULL, NULL));
 #endif
@@ -211,9 +302,30 @@ void spi_init(void)
 
 void oled_init()
 {
+    SSD1309_Config_t oled_config =
+    {
+        .Width      = SSD1309_WIDTH,
+        .Height     = SSD1309_HEIGHT,
+        .OffsetX    = SSD1309_OFFSET_X,
+        .OffsetY    = SSD1309_OFFSET_Y,
+        .Buffer     = m_oled_buffer,
+#if SPI_USE_INTERRUPT
+        .BackBuffer = m_oled_back_buffer,
+#endif
+#if defined(SSD1309_USE_I2C)
+        .CommHandle = i2c_oled_comm_handle,
+        .Address    = SSD1309_I2C_ADDR,
+#elif defined(SSD1309_USE_SPI)
+        .CommHandle = spi_oled_comm_handle,
+#endif
+    };
+
     oled_enable();
-    ssd1309_Init(spi_oled_comm_handle);
-    ssd1309_Fill(Black);
+    APP_ERROR_CHECK(ssd1309_Init(&m_oled, &oled_config));
+#if SPI_USE_INTERRUPT
+    ssd1309_SetAsyncHandle(&m_oled, spi_oled_async_handle);
+#endif
+    ssd1309_Fill(&m_oled, Black);
 }
 
 int main(void)
@@ -236,6 +348,11 @@ int main(void)
 	
     /* Initialize oled. */
     oled_init();	
+
+    /* Boot splash straight from flash to controller column 0, */
+    /* the screenbuffer is not touched                         */
+    APP_ERROR_CHECK(ssd1309_StreamImage(&m_oled, -SSD1309_OFFSET_X, 0, &garfield_128x64_rle));
+    nrf_delay_ms(3000);
 	
     while (1)
     {
@@ -246,31 +363,30 @@ int main(void)
         nrf_delay_ms(3000);
 
         oled_clear_screen();
-        ssd1309_Polyline(loc_vertex, sizeof(loc_vertex) / sizeof(loc_vertex[0]), White);
-        ssd1309_DrawArc(30, 30, 25, 0, 360, White);
+        ssd1309_Polyline(&m_oled, loc_vertex, sizeof(loc_vertex) / sizeof(loc_vertex[0]), White);
+        ssd1309_DrawArc(&m_oled, 30, 30, 25, 0, 360, White);
         oled_update_screen();
         nrf_delay_ms(3000);
 
-        oled_clear_screen();
-        ssd1309_Fill(White);
-        ssd1309_DrawBitmap(0, 0, garfield_128x64, 128, 64, Black);
+        /* Full screen copy, no fill needed */
+        ssd1309_DrawPageBitmap(&m_oled, 0, 0, &garfield_128x64_page, SSD1309_ROP_COPY);
         oled_update_screen();
         nrf_delay_ms(3000);
 
-        ssd1309_Fill(Black);
-        ssd1309_DrawBitmap(32, 0, github_logo_64x64, 64, 64, White);
+        ssd1309_Fill(&m_oled, Black);
+        ssd1309_DrawPageBitmap(&m_oled, 32, 0, &github_logo_64x64_page, SSD1309_ROP_OR);
         oled_update_screen();
         nrf_delay_ms(3000);
 
-        ssd1309_Fill(White);
-        ssd1309_DrawBitmap(32, 0, github_logo_64x64, 64, 64, Black);
+        ssd1309_Fill(&m_oled, White);
+        ssd1309_DrawPageBitmap(&m_oled, 32, 0, &github_logo_64x64_page, SSD1309_ROP_CLEAR);
         oled_update_screen();
         nrf_delay_ms(3000);
 
         oled_clear_screen();
         for (uint32_t delta = 0; delta < 5; delta++)
         {
-            ssd1309_DrawCircle(20 * delta + 30, 15, 10, White);
+            ssd1309_DrawCircle(&m_oled, 20 * delta + 30, 15, 10, White);
         }
         oled_update_screen();
         nrf_delay_ms(3000);
@@ -278,7 +394,7 @@ int main(void)
         oled_clear_screen();
         for (uint32_t delta = 0; delta < 5; delta++)
         {
-            ssd1309_DrawRectangle(1 + (5 * delta), 1 + (5 * delta), SSD1309_WIDTH - 1 - (5 * delta), SSD1309_HEIGHT - 1 - (5 * delta), White);
+            ssd1309_DrawRectangle(&m_oled, 1 + (5 * delta), 1 + (5 * delta), SSD1309_WIDTH - 1 - (5 * delta), SSD1309_HEIGHT - 1 - (5 * delta), White);
         }
         oled_update_screen();
         nrf_delay_ms(3000);
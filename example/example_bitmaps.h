@@ -0,0 +1,144 @@
+/* Generated by tools/bmpconv.py, do not edit */
+
+#ifndef __EXAMPLE_BITMAPS_H__
+#define __EXAMPLE_BITMAPS_H__
+
+/* github_logo_64x64_page: 64x64, 8 bands of 64 columns */
+static const uint8_t github_logo_64x64_pageData [] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0,
+    0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xF0,
+    0xE0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
+    0x1F, 0x1F, 0x3F, 0x3F, 0x3F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x7F,
+    0x7F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x3F, 0x3F, 0x1F, 0x1F,
+    0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xF0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0x80, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
+    0x00, 0x03, 0x0F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x8F, 0x1F, 0x1F, 0x3F, 0x7E, 0xFC,
+    0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8,
+    0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x0F, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFC, 0xF0, 0xE0, 0xC1,
+    0x83, 0x83, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07,
+    0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F,
+    0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static const SSD1309_Bitmap_t github_logo_64x64_page = {64, 64, github_logo_64x64_pageData, NULL};
+
+/* garfield_128x64_page: 128x64, 8 bands of 128 columns, inverted */
+static const uint8_t garfield_128x64_pageData [] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x83, 0x03, 0x01, 0x81, 0x01,
+    0xC1, 0xC1, 0xE1, 0xE1, 0xE1, 0xF1, 0xE1, 0xE1, 0xC3, 0xC3, 0xCB, 0x9B, 0x33, 0x37, 0x07, 0x07,
+    0x87, 0x83, 0xC3, 0x83, 0x83, 0xC3, 0xC3, 0x83, 0x83, 0x83, 0x83, 0x07, 0x17, 0x37, 0x67, 0xEF,
+    0xCF, 0xDF, 0x9F, 0xBF, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x6F, 0x6B, 0x2A, 0x8E, 0x8D, 0x8D, 0x05, 0x07, 0x83, 0xC3, 0xE2, 0xE4, 0xF1, 0xF9,
+    0xF9, 0xFD, 0xFD, 0x7D, 0x3E, 0xBE, 0xDE, 0xCF, 0xEF, 0xF7, 0xF7, 0xFA, 0xFA, 0xFC, 0xFC, 0xFC,
+    0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF3, 0x07, 0x8F, 0xEE, 0xEC,
+    0xE1, 0xE3, 0xFF, 0xFF, 0x7F, 0x1C, 0x01, 0x03, 0x0F, 0x1F, 0x1F, 0x1F, 0x2F, 0x2F, 0x2F, 0x27,
+    0x27, 0x27, 0x3F, 0x3F, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x1F, 0x07, 0x43,
+    0xE1, 0xF0, 0xF0, 0xF0, 0xF3, 0xF1, 0xC1, 0x00, 0x6E, 0xEF, 0xEF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF,
+    0x07, 0x01, 0x18, 0xDE, 0xDF, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF,
+    0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0x5F, 0x1F, 0x9F, 0x9F, 0xCF, 0xE7, 0xF1, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xF7, 0xF3, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0x78, 0x78, 0x78, 0x70, 0x30, 0x30, 0x01, 0x07,
+    0x1E, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xC0, 0x80, 0x00,
+    0x38, 0x7D, 0x63, 0x41, 0x19, 0x3D, 0x3E, 0x7E, 0x7F, 0xFE, 0xEE, 0xEC, 0xE0, 0xF2, 0xF2, 0xF6,
+    0xF6, 0xE6, 0xEE, 0xC8, 0xD9, 0xDD, 0x9D, 0x9D, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7D, 0x7D,
+    0x7D, 0x3D, 0x38, 0x82, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x1F, 0x1F, 0x3F, 0x1F, 0x1F,
+    0x1F, 0x3F, 0x3C, 0x3F, 0x3F, 0x78, 0x7C, 0x7F, 0x70, 0x78, 0x7C, 0x3E, 0x00, 0x80, 0xC0, 0xE0,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFE, 0xFE, 0x7E, 0x3C, 0xBC, 0x9C, 0xD8, 0xE8, 0xE1, 0xF3, 0xF3, 0xFB, 0xFA, 0xF0, 0xF1,
+    0xF3, 0xF7, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xE6, 0xE6, 0xE6,
+    0xE7, 0xE7, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x73, 0xF3, 0x07, 0x87, 0x87, 0x02, 0x82, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xF8, 0xFC, 0xFC, 0xFC, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x8F, 0xC7, 0xE3,
+    0xF1, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1C, 0x89, 0xE0, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE4, 0xE7, 0xF7, 0xEF, 0x0F, 0x07, 0x87,
+    0x87, 0xC6, 0xC0, 0xC0, 0xF0, 0x61, 0xE1, 0xE3, 0x67, 0x07, 0x0F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xC0, 0x9E, 0x3F, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x07, 0x03, 0x79, 0x7C, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7D, 0x7C, 0xBC, 0x9D, 0x09,
+    0x01, 0x21, 0x31, 0x30, 0x30, 0x30, 0x3D, 0x01, 0x00, 0x80, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
+    0xFC, 0xFD, 0xFD, 0xFB, 0xFB, 0xFB, 0xFB, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xEF, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0xCC, 0xED, 0xED, 0xE1, 0xC1,
+    0x03, 0x03, 0xFB, 0xFB, 0xFB, 0xFB, 0xFD, 0xFC, 0xFC, 0xFE, 0x02, 0x03, 0x01, 0x01, 0x06, 0x00,
+    0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+static const SSD1309_Bitmap_t garfield_128x64_page = {128, 64, garfield_128x64_pageData, NULL};
+
+/* garfield_128x64_rle: 128x64, 419 bytes run-length coded from 1024, inverted */
+static const uint8_t garfield_128x64_rleData [] = {
+    0xA8, 0xFF, 0x07, 0xC7, 0x83, 0x03, 0x01, 0x81, 0x01, 0xC1, 0xC1, 0x81, 0xE1, 0x11, 0xF1, 0xE1,
+    0xE1, 0xC3, 0xC3, 0xCB, 0x9B, 0x33, 0x37, 0x07, 0x07, 0x87, 0x83, 0xC3, 0x83, 0x83, 0xC3, 0xC3,
+    0x82, 0x83, 0x0A, 0x07, 0x17, 0x37, 0x67, 0xEF, 0xCF, 0xDF, 0x9F, 0xBF, 0x3F, 0x7F, 0xBF, 0xFF,
+    0x89, 0xFF, 0x1A, 0x6F, 0x6B, 0x2A, 0x8E, 0x8D, 0x8D, 0x05, 0x07, 0x83, 0xC3, 0xE2, 0xE4, 0xF1,
+    0xF9, 0xF9, 0xFD, 0xFD, 0x7D, 0x3E, 0xBE, 0xDE, 0xCF, 0xEF, 0xF7, 0xF7, 0xFA, 0xFA, 0x81, 0xFC,
+    0x83, 0xFE, 0x83, 0xFF, 0x0E, 0xFB, 0xF3, 0x07, 0x8F, 0xEE, 0xEC, 0xE1, 0xE3, 0xFF, 0xFF, 0x7F,
+    0x1C, 0x01, 0x03, 0x0F, 0x81, 0x1F, 0x81, 0x2F, 0x81, 0x27, 0x02, 0x3F, 0x3F, 0xBF, 0xB5, 0xFF,
+    0x04, 0x3F, 0x1F, 0x07, 0x43, 0xE1, 0x81, 0xF0, 0x06, 0xF3, 0xF1, 0xC1, 0x00, 0x6E, 0xEF, 0xEF,
+    0x83, 0xDF, 0x04, 0x07, 0x01, 0x18, 0xDE, 0xDF, 0x83, 0x9F, 0x89, 0xDF, 0x07, 0x5F, 0x1F, 0x9F,
+    0x9F, 0xCF, 0xE7, 0xF1, 0xF8, 0x81, 0xFF, 0x03, 0xF7, 0xF3, 0xF1, 0xF1, 0x82, 0xF0, 0x81, 0x78,
+    0x05, 0x70, 0x30, 0x30, 0x01, 0x07, 0x1E, 0x83, 0xFE, 0xB4, 0xFF, 0x1C, 0xF0, 0xC0, 0x80, 0x00,
+    0x38, 0x7D, 0x63, 0x41, 0x19, 0x3D, 0x3E, 0x7E, 0x7F, 0xFE, 0xEE, 0xEC, 0xE0, 0xF2, 0xF2, 0xF6,
+    0xF6, 0xE6, 0xEE, 0xC8, 0xD9, 0xDD, 0x9D, 0x9D, 0xBD, 0x82, 0xFF, 0x00, 0xFD, 0x81, 0x7D, 0x03,
+    0x3D, 0x38, 0x82, 0xC6, 0x83, 0xFF, 0x03, 0xDF, 0x1F, 0x1F, 0x3F, 0x81, 0x1F, 0x0F, 0x3F, 0x3C,
+    0x3F, 0x3F, 0x78, 0x7C, 0x7F, 0x70, 0x78, 0x7C, 0x3E, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xBE, 0xFF,
+    0x11, 0xFE, 0xFE, 0x7E, 0x3C, 0xBC, 0x9C, 0xD8, 0xE8, 0xE1, 0xF3, 0xF3, 0xFB, 0xFA, 0xF0, 0xF1,
+    0xF3, 0xF7, 0xF7, 0x85, 0xFF, 0x81, 0xFE, 0x81, 0xE6, 0x02, 0xE7, 0xE7, 0xF1, 0x83, 0xF0, 0x07,
+    0x73, 0xF3, 0x07, 0x87, 0x87, 0x02, 0x82, 0xC0, 0xC3, 0x01, 0x80, 0xF8, 0x81, 0xFC, 0x01, 0xFE,
+    0xFE, 0xBE, 0xFF, 0x08, 0x7F, 0x1F, 0x8F, 0xC7, 0xE3, 0xF1, 0xF8, 0xFC, 0xFE, 0x94, 0xFF, 0x04,
+    0x7F, 0x1C, 0x89, 0xE0, 0xFC, 0x86, 0xFF, 0x14, 0xE0, 0xE0, 0xE4, 0xE7, 0xF7, 0xEF, 0x0F, 0x07,
+    0x87, 0x87, 0xC6, 0xC0, 0xC0, 0xF0, 0x61, 0xE1, 0xE3, 0x67, 0x07, 0x0F, 0x3F, 0xBC, 0xFF, 0x04,
+    0xE0, 0xC0, 0x9E, 0x3F, 0x7F, 0x94, 0xFF, 0x05, 0x8F, 0x07, 0x03, 0x79, 0x7C, 0xFE, 0x8D, 0xFF,
+    0x08, 0x7F, 0x7D, 0x7C, 0xBC, 0x9D, 0x09, 0x01, 0x21, 0x31, 0x81, 0x30, 0x05, 0x3D, 0x01, 0x00,
+    0x80, 0xC0, 0xF0, 0xBF, 0xFF, 0x05, 0xFF, 0xFE, 0xFE, 0xFC, 0xFD, 0xFD, 0x82, 0xFB, 0x84, 0xF7,
+    0x00, 0xEF, 0x87, 0x0F, 0x82, 0x0E, 0x06, 0xCC, 0xED, 0xED, 0xE1, 0xC1, 0x03, 0x03, 0x82, 0xFB,
+    0x08, 0xFD, 0xFC, 0xFC, 0xFE, 0x02, 0x03, 0x01, 0x01, 0x06, 0xC1, 0x01, 0x80, 0x80, 0xC3, 0x00,
+    0xFE, 0xA6, 0xFF,
+};
+static const SSD1309_Image_t garfield_128x64_rle = {128, 64, garfield_128x64_rleData};
+
+#endif /* __EXAMPLE_BITMAPS_H__ */
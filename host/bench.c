@@ -0,0 +1,620 @@
+/**
+ * Micro-benchmark of the drawing primitives and of the update.
+ *
+ * Every case runs over the same pseudo-random arguments (and the screens of
+ * example/example.c) twice: timed back to back, then one call per update
+ * with the trace hooks on. Per call it reports:
+ *
+ *   time      BENCH_UNIT per call (trace hooks idle but compiled in)
+ *   pixels    ssd1309_DrawPixel() invocations
+ *   fb bytes  distinct screenbuffer bytes written
+ *   bus       bytes and transactions of the update that follows the call
+ *
+ * On target, build it with BENCH_NO_MAIN and SSD1309_TRACE, define
+ * BENCH_NOW() to read a cycle counter (e.g. DWT->CYCCNT), BENCH_UNIT to
+ * "cycles" and call bench_Run() on an initialised display.
+ *
+ * Usage: bench
+ */
+
+#include <stdio.h>
+
+#include "ssd1309.h"
+#include "example_bitmaps.h"
+
+#if !defined(BENCH_NOW)
+#include <time.h>
+
+/* Host clock in nanoseconds */
+static uint32_t bench_Now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint32_t)(now.tv_sec * 1000000000ull + now.tv_nsec);
+}
+
+#define BENCH_NOW()     bench_Now()
+#define BENCH_UNIT      "ns"
+#endif
+
+/* Calls per case and timed passes over them */
+#define BENCH_CALLS     256
+#define BENCH_ROUNDS    8
+
+/* Arguments of one call */
+typedef struct
+{
+    uint8_t X[5];
+    uint8_t Y[5];
+    uint8_t CX;
+    uint8_t CY;
+    uint8_t R;
+    uint16_t Start;
+    uint16_t Sweep;
+} BENCH_ARGS;
+
+/* A primitive or a screen and the way to call it */
+typedef struct
+{
+    const char *Name;
+    void (*Run)(SSD1309_t *dev, const BENCH_ARGS *args);
+    bool Flushes;       /* The case sends its own update */
+    SSD1309_ROTATION Rotation;
+} BENCH_CASE;
+
+/* Figures of one case, per call */
+typedef struct
+{
+    float Time;
+    float Pixels;
+    float Bytes;
+    float BusBytes;
+    float Transactions;
+} BENCH_RESULT;
+
+static BENCH_ARGS m_args[BENCH_CALLS];
+static BENCH_ARGS m_portrait_args[BENCH_CALLS];     /* The same, x and y swapped */
+
+static char m_text[]  = "Testing 123!!";
+static char m_clock[] = "12:00";
+static char m_note[]  = "Battery low, connect the charger";
+
+/* 16x16 row-major bitmap, MSB first: a framed diagonal cross */
+static const unsigned char m_icon[] =
+{
+    0xFF, 0xFF, 0xC0, 0x03, 0xA0, 0x05, 0x90, 0x09, 0x88, 0x11, 0x84, 0x21, 0x82, 0x41, 0x81, 0x81,
+    0x81, 0x81, 0x82, 0x41, 0x84, 0x21, 0x88, 0x11, 0x90, 0x09, 0xA0, 0x05, 0xC0, 0x03, 0xFF, 0xFF
+};
+
+
+#if defined(SSD1309_TRACE)
+/* Screenbuffer writes seen by the trace hooks */
+static struct
+{
+    bool Enabled;
+    uint32_t Pixels;
+    uint32_t Bytes;
+    uint8_t Touched[255 * SSD1309_MAX_PAGES];
+} m_trace;
+
+
+/* Count a screenbuffer byte the first time it is written */
+static void bench_Touch(uint32_t offset)
+{
+    if (!m_trace.Touched[offset])
+    {
+        m_trace.Touched[offset] = 1;
+        m_trace.Bytes++;
+    }
+}
+
+
+/* Trace hook of ssd1309_DrawPixel() */
+void ssd1309_TracePixel(SSD1309_t *dev, uint8_t x, uint8_t y)
+{
+    if (m_trace.Enabled)
+    {
+        m_trace.Pixels++;
+        bench_Touch(x + (y / 8) * dev->Width);
+    }
+}
+
+
+/* Trace hook of the bulk screenbuffer writes */
+void ssd1309_TraceBytes(SSD1309_t *dev, uint32_t offset, uint32_t length)
+{
+    (void)dev;
+
+    if (m_trace.Enabled)
+    {
+        for (uint32_t i = 0; i < length; i++)
+        {
+            bench_Touch(offset + i);
+        }
+    }
+}
+#endif
+
+
+/* Deterministic pseudo-random numbers, the same run after run */
+static uint32_t bench_Random(uint32_t *state, uint32_t range)
+{
+    *state = *state * 1664525u + 1013904223u;
+
+    return (*state >> 8) % range;
+}
+
+
+/* Arguments inside the display, shapes of all sizes */
+static void bench_MakeArgs(SSD1309_t *dev)
+{
+    uint32_t state = 1;
+
+    for (uint32_t i = 0; i < BENCH_CALLS; i++)
+    {
+        for (uint8_t j = 0; j < 5; j++)
+        {
+            m_args[i].X[j] = bench_Random(&state, dev->Width);
+            m_args[i].Y[j] = bench_Random(&state, dev->Height);
+        }
+
+        /* Round shapes inside the display */
+        m_args[i].R     = 1 + bench_Random(&state, dev->Height / 2 - 2);
+        m_args[i].CX    = m_args[i].R + 1 + bench_Random(&state, dev->Width - 2 * m_args[i].R - 2);
+        m_args[i].CY    = m_args[i].R + 1 + bench_Random(&state, dev->Height - 2 * m_args[i].R - 2);
+        m_args[i].Start = bench_Random(&state, 360);
+        m_args[i].Sweep = 1 + bench_Random(&state, 360);
+
+        m_portrait_args[i] = m_args[i];
+        memcpy(m_portrait_args[i].X, m_args[i].Y, sizeof(m_args[i].Y));
+        memcpy(m_portrait_args[i].Y, m_args[i].X, sizeof(m_args[i].X));
+        m_portrait_args[i].CX = m_args[i].CY;
+        m_portrait_args[i].CY = m_args[i].CX;
+    }
+}
+
+
+static void bench_DrawPixel(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    ssd1309_DrawPixel(dev, args->X[0], args->Y[0], White);
+}
+
+static void bench_DrawLine(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    ssd1309_DrawLine(dev, args->X[0], args->Y[0], args->X[1], args->Y[1], White);
+}
+
+static void bench_DrawHLine(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    ssd1309_DrawHLine(dev, args->X[0], args->X[1], args->Y[0], White);
+}
+
+static void bench_DrawVLine(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    ssd1309_DrawVLine(dev, args->X[0], args->Y[0], args->Y[1], White);
+}
+
+static void bench_DrawRectangle(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    ssd1309_DrawRectangle(dev, args->X[0], args->Y[0], args->X[1], args->Y[1], White);
+}
+
+static void bench_FillRectangle(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    ssd1309_FillRectangle(dev, args->X[0], args->Y[0], args->X[1], args->Y[1], White);
+}
+
+static void bench_FillRectangleInverse(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    ssd1309_FillRectangle(dev, args->X[0], args->Y[0], args->X[1], args->Y[1], Inverse);
+}
+
+static void bench_DrawCircle(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    ssd1309_DrawCircle(dev, args->CX, args->CY, args->R, White);
+}
+
+static void bench_FillCircle(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    ssd1309_FillCircle(dev, args->CX, args->CY, args->R, White);
+}
+
+static void bench_FillRoundRect(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    ssd1309_FillRoundRect(dev, args->X[0], args->Y[0], args->X[1], args->Y[1], args->R / 2, White);
+}
+
+static void bench_DrawEllipse(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    ssd1309_DrawEllipse(dev, args->CX, args->CY, args->R + args->X[2] / 4, args->R, White);
+}
+
+static void bench_FillEllipse(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    ssd1309_FillEllipse(dev, args->CX, args->CY, args->R + args->X[2] / 4, args->R, White);
+}
+
+static void bench_DrawArc(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    ssd1309_DrawArc(dev, args->CX, args->CY, args->R, args->Start, args->Sweep, White);
+}
+
+static void bench_FillPie(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    ssd1309_FillPie(dev, args->CX, args->CY, args->R, args->Start, args->Sweep, White);
+}
+
+static void bench_FillRing(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    ssd1309_FillRing(dev, args->CX, args->CY, args->R, 1 + args->R / 3, args->Start, args->Sweep, White);
+}
+
+static void bench_Polyline(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    SSD1309_VERTEX vertex[5];
+
+    for (uint8_t i = 0; i < 5; i++)
+    {
+        vertex[i].x = args->X[i];
+        vertex[i].y = args->Y[i];
+    }
+
+    ssd1309_Polyline(dev, vertex, 5, White);
+}
+
+static void bench_WriteString7x10(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    ssd1309_SetCursor(dev, args->X[0] / 4, args->Y[0]);
+    ssd1309_WriteString(dev, m_text, Font_7x10, White);
+}
+
+static void bench_WriteStringInverse(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    ssd1309_SetCursor(dev, args->X[0] / 4, args->Y[0]);
+    ssd1309_WriteString(dev, m_text, Font_7x10, Inverse);
+}
+
+static void bench_WriteString11x18(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    ssd1309_SetCursor(dev, args->X[0] / 2, args->Y[0] / 2);
+    ssd1309_WriteString(dev, m_clock, Font_11x18, White);
+}
+
+static void bench_WriteText7x10(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    ssd1309_SetCursor(dev, args->X[0] / 4, args->Y[0]);
+    ssd1309_WriteText(dev, m_text, &FontProp_7x10, White);
+}
+
+static void bench_WriteText11x18(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    ssd1309_SetCursor(dev, args->X[0] / 2, args->Y[0] / 2);
+    ssd1309_WriteText(dev, m_clock, &FontProp_11x18, White);
+}
+
+static void bench_DrawText(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    SSD1309_RECT rect = {args->X[0] / 4, args->Y[0] / 2, args->X[0] / 4 + 63, args->Y[0] / 2 + 29};
+
+    ssd1309_DrawText(dev, &rect, m_note, &FontProp_7x10, SSD1309_ALIGN_CENTER, SSD1309_WRAP_WORD, White);
+}
+
+static void bench_DrawBitmap(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    ssd1309_DrawBitmap(dev, args->X[0], args->Y[0], m_icon, 16, 16, White);
+}
+
+static void bench_DrawPageBitmapCopy(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    (void)args;
+
+    ssd1309_DrawPageBitmap(dev, 0, 0, &garfield_128x64_page, SSD1309_ROP_COPY);
+}
+
+static void bench_DrawPageBitmapOr(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    ssd1309_DrawPageBitmap(dev, args->X[0] / 2, args->Y[0], &github_logo_64x64_page, SSD1309_ROP_OR);
+}
+
+static void bench_Fill(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    (void)args;
+
+    ssd1309_Fill(dev, White);
+}
+
+static void bench_UpdateScreen(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    (void)args;
+
+    ssd1309_Invalidate(dev);
+    ssd1309_UpdateScreen(dev);
+}
+
+static void bench_UpdateScreenClean(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    (void)args;
+
+    ssd1309_UpdateScreen(dev);
+}
+
+
+/* Screens of example/example.c */
+static void bench_ScreenText(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    (void)args;
+
+    ssd1309_Fill(dev, Black);
+    ssd1309_WriteSymbol(dev, BLE, 32, 0);
+    ssd1309_SetCursor(dev, 0, 32);
+    ssd1309_WriteString(dev, m_text, Font_7x10, White);
+}
+
+static void bench_ScreenArc(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    static const SSD1309_VERTEX vertex[] =
+    {
+        {35, 40}, {40, 20}, {45, 28}, {50, 10}, {45, 16}, {50, 10}, {53, 16}
+    };
+
+    (void)args;
+
+    ssd1309_Fill(dev, Black);
+    ssd1309_Polyline(dev, vertex, sizeof(vertex) / sizeof(vertex[0]), White);
+    ssd1309_DrawArc(dev, 30, 30, 25, 0, 360, White);
+}
+
+static void bench_ScreenCircles(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    (void)args;
+
+    ssd1309_Fill(dev, Black);
+    for (uint32_t delta = 0; delta < 5; delta++)
+    {
+        ssd1309_DrawCircle(dev, 20 * delta + 30, 15, 10, White);
+    }
+}
+
+static void bench_ScreenRectangles(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    (void)args;
+
+    ssd1309_Fill(dev, Black);
+    for (uint32_t delta = 0; delta < 5; delta++)
+    {
+        ssd1309_DrawRectangle(dev, 1 + (5 * delta), 1 + (5 * delta),
+                              dev->Width - 1 - (5 * delta), dev->Height - 1 - (5 * delta), White);
+    }
+}
+
+static void bench_ScreenClock(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    (void)args;
+
+    ssd1309_SetCursor(dev, 30, 28);
+    ssd1309_WriteString(dev, m_clock, Font_11x18, White);
+}
+
+/* A menu scrolled by a few rows, the items below the title are clipped to the list */
+static void bench_ScreenList(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    static const char *items[] = {"Display", "Sound", "Bluetooth", "Battery", "About"};
+    SSD1309_RECT list          = {0, 12, dev->Width - 1, dev->Height - 1};
+
+    ssd1309_Fill(dev, Black);
+    ssd1309_SetCursor(dev, 0, 0);
+    ssd1309_WriteText(dev, "Settings", &FontProp_7x10, White);
+    ssd1309_DrawHLine(dev, 0, dev->Width - 1, 11, White);
+
+    ssd1309_PushClip(dev, &list);
+    for (uint8_t item = 0; item < 5; item++)
+    {
+        ssd1309_SetOrigin(dev, 0, 12 + 16 * item - args->Y[0] % 16);
+        ssd1309_DrawRectangle(dev, 2, 1, dev->Width - 3, 14, White);
+        ssd1309_SetCursor(dev, 6, 3);
+        ssd1309_WriteString(dev, (char *)items[item], Font_7x10, White);
+    }
+    ssd1309_PopClip(dev);
+}
+
+/* A gauge filled to a varying value next to a pie chart */
+static void bench_ScreenGauge(SSD1309_t *dev, const BENCH_ARGS *args)
+{
+    ssd1309_Fill(dev, Black);
+    ssd1309_DrawArc(dev, 34, 34, 28, 45, 315, White);
+    ssd1309_FillRing(dev, 34, 34, 25, 6, 45 + args->Start * 3 / 4, 315, White);
+    ssd1309_FillPie(dev, 98, 32, 20, 0, args->Start, White);
+    ssd1309_DrawArcWithRadiusLine(dev, 98, 32, 20, args->Start, 360, White);
+}
+
+
+static const BENCH_CASE m_cases[] =
+{
+    {.Name = "DrawPixel",           .Run = bench_DrawPixel,            .Flushes = false},
+    {.Name = "DrawLine",            .Run = bench_DrawLine,             .Flushes = false},
+    {.Name = "DrawHLine",           .Run = bench_DrawHLine,            .Flushes = false},
+    {.Name = "DrawVLine",           .Run = bench_DrawVLine,            .Flushes = false},
+    {.Name = "DrawRectangle",       .Run = bench_DrawRectangle,        .Flushes = false},
+    {.Name = "FillRectangle",       .Run = bench_FillRectangle,        .Flushes = false},
+    {.Name = "FillRectangle Inv",   .Run = bench_FillRectangleInverse, .Flushes = false},
+    {.Name = "DrawCircle",          .Run = bench_DrawCircle,           .Flushes = false},
+    {.Name = "FillCircle",          .Run = bench_FillCircle,           .Flushes = false},
+    {.Name = "FillRoundRect",       .Run = bench_FillRoundRect,        .Flushes = false},
+    {.Name = "DrawEllipse",         .Run = bench_DrawEllipse,          .Flushes = false},
+    {.Name = "FillEllipse",         .Run = bench_FillEllipse,          .Flushes = false},
+    {.Name = "DrawArc",             .Run = bench_DrawArc,              .Flushes = false},
+    {.Name = "FillPie",             .Run = bench_FillPie,              .Flushes = false},
+    {.Name = "FillRing",            .Run = bench_FillRing,             .Flushes = false},
+    {.Name = "Polyline",            .Run = bench_Polyline,             .Flushes = false},
+    {.Name = "WriteString 7x10",    .Run = bench_WriteString7x10,      .Flushes = false},
+    {.Name = "WriteString Inv",     .Run = bench_WriteStringInverse,   .Flushes = false},
+    {.Name = "WriteString 11x18",   .Run = bench_WriteString11x18,     .Flushes = false},
+    {.Name = "WriteText 7x10",      .Run = bench_WriteText7x10,        .Flushes = false},
+    {.Name = "WriteText 11x18",     .Run = bench_WriteText11x18,       .Flushes = false},
+    {.Name = "DrawText wrapped",    .Run = bench_DrawText,             .Flushes = false},
+    {.Name = "DrawBitmap 16x16",    .Run = bench_DrawBitmap,           .Flushes = false},
+    {.Name = "PageBitmap 128x64",   .Run = bench_DrawPageBitmapCopy,   .Flushes = false},
+    {.Name = "PageBitmap 64x64 OR", .Run = bench_DrawPageBitmapOr,     .Flushes = false},
+    {.Name = "Fill",                .Run = bench_Fill,                 .Flushes = false},
+    {.Name = "UpdateScreen full",   .Run = bench_UpdateScreen,         .Flushes = true},
+    {.Name = "UpdateScreen clean",  .Run = bench_UpdateScreenClean,    .Flushes = true},
+    {.Name = "screen text",         .Run = bench_ScreenText,           .Flushes = false},
+    {.Name = "screen arc",          .Run = bench_ScreenArc,            .Flushes = false},
+    {.Name = "screen circles",      .Run = bench_ScreenCircles,        .Flushes = false},
+    {.Name = "screen rectangles",   .Run = bench_ScreenRectangles,     .Flushes = false},
+    {.Name = "screen clock",        .Run = bench_ScreenClock,          .Flushes = false},
+    {.Name = "screen list",         .Run = bench_ScreenList,           .Flushes = false},
+    {.Name = "screen gauge",        .Run = bench_ScreenGauge,          .Flushes = false},
+    {.Name = "DrawLine 90",         .Run = bench_DrawLine,             .Flushes = false, .Rotation = ROTATION_90},
+    {.Name = "FillRectangle 90",    .Run = bench_FillRectangle,        .Flushes = false, .Rotation = ROTATION_90},
+    {.Name = "FillCircle 90",       .Run = bench_FillCircle,           .Flushes = false, .Rotation = ROTATION_90},
+    {.Name = "WriteString 7x10 90", .Run = bench_WriteString7x10,      .Flushes = false, .Rotation = ROTATION_90},
+    {.Name = "WriteText 7x10 90",   .Run = bench_WriteText7x10,        .Flushes = false, .Rotation = ROTATION_90},
+    {.Name = "DrawText 90",         .Run = bench_DrawText,             .Flushes = false, .Rotation = ROTATION_90},
+    {.Name = "PageBitmap OR 90",    .Run = bench_DrawPageBitmapOr,     .Flushes = false, .Rotation = ROTATION_90},
+};
+
+
+/* Time the calls back to back, then account them one update at a time */
+static void bench_Case(SSD1309_t *dev, const BENCH_CASE *bench, BENCH_RESULT *result)
+{
+    SSD1309_Throughput_t throughput;
+    uint32_t start;
+    uint32_t ticks;
+    uint32_t bus_bytes     = 0;
+    uint32_t transactions  = 0;
+    bool portrait          = (bench->Rotation == ROTATION_90) || (bench->Rotation == ROTATION_270);
+    const BENCH_ARGS *args = portrait ? m_portrait_args : m_args;
+
+    ssd1309_SetRotation(dev, bench->Rotation);
+    ssd1309_Fill(dev, Black);
+    ssd1309_UpdateScreen(dev);
+
+    start = BENCH_NOW();
+    for (uint32_t round = 0; round < BENCH_ROUNDS; round++)
+    {
+        for (uint32_t i = 0; i < BENCH_CALLS; i++)
+        {
+            bench->Run(dev, &args[i]);
+        }
+    }
+    ticks = BENCH_NOW() - start;
+
+#if defined(SSD1309_TRACE)
+    uint32_t pixels = 0;
+    uint32_t bytes  = 0;
+#endif
+
+    for (uint32_t i = 0; i < BENCH_CALLS; i++)
+    {
+        ssd1309_Fill(dev, Black);
+        ssd1309_UpdateScreen(dev);
+
+#if defined(SSD1309_TRACE)
+        memset(m_trace.Touched, 0, sizeof(m_trace.Touched));
+        m_trace.Pixels  = 0;
+        m_trace.Bytes   = 0;
+        m_trace.Enabled = true;
+#endif
+
+        bench->Run(dev, &args[i]);
+
+#if defined(SSD1309_TRACE)
+        m_trace.Enabled = false;
+        pixels += m_trace.Pixels;
+        bytes  += m_trace.Bytes;
+#endif
+
+        if (!bench->Flushes)
+        {
+            ssd1309_UpdateScreen(dev);
+        }
+
+        ssd1309_GetThroughput(dev, &throughput);
+        bus_bytes    += throughput.Bytes;
+        transactions += throughput.Transactions;
+    }
+
+    ssd1309_SetRotation(dev, ROTATION_0);
+
+    result->Time         = (float)ticks / (BENCH_ROUNDS * BENCH_CALLS);
+    result->BusBytes     = (float)bus_bytes / BENCH_CALLS;
+    result->Transactions = (float)transactions / BENCH_CALLS;
+#if defined(SSD1309_TRACE)
+    result->Pixels       = (float)pixels / BENCH_CALLS;
+    result->Bytes        = (float)bytes / BENCH_CALLS;
+#else
+    result->Pixels       = -1;
+    result->Bytes        = -1;
+#endif
+}
+
+
+/* Run every case on an initialised display and print the table */
+void bench_Run(SSD1309_t *dev)
+{
+    BENCH_RESULT result;
+
+    bench_MakeArgs(dev);
+
+    printf("%-20s %10s %9s %9s %10s %7s\n", "case", BENCH_UNIT "/call", "pixels", "fb bytes", "bus bytes", "transac");
+
+    for (uint32_t i = 0; i < sizeof(m_cases) / sizeof(m_cases[0]); i++)
+    {
+        bench_Case(dev, &m_cases[i], &result);
+
+        printf("%-20s %10.1f %9.1f %9.1f %10.1f %7.1f\n", m_cases[i].Name,
+               result.Time, result.Pixels, result.Bytes, result.BusBytes, result.Transactions);
+    }
+}
+
+
+#if !defined(BENCH_NO_MAIN)
+/* Transport that drops everything: the figures are the driver's own */
+#if defined(SSD1309_USE_I2C)
+static void bench_Transport(uint8_t address, uint8_t *buffer, size_t size)
+#else
+static void bench_Transport(uint8_t type, uint8_t *buffer, size_t size)
+#endif
+{
+    /* Nothing to do */
+#if defined(SSD1309_USE_I2C)
+    (void)address;
+#else
+    (void)type;
+#endif
+    (void)buffer;
+    (void)size;
+}
+
+
+int main(void)
+{
+    static SSD1309_t oled;
+    static uint8_t buffer[SSD1309_BUFFER_BYTES(SSD1309_WIDTH, SSD1309_HEIGHT)];
+    SSD1309_Config_t config =
+    {
+        .Width      = SSD1309_WIDTH,
+        .Height     = SSD1309_HEIGHT,
+        .OffsetX    = SSD1309_OFFSET_X,
+        .OffsetY    = SSD1309_OFFSET_Y,
+        .Buffer     = buffer,
+        .CommHandle = bench_Transport,
+#if defined(SSD1309_USE_I2C)
+        .Address    = SSD1309_I2C_ADDR,
+#endif
+    };
+
+    if (ssd1309_Init(&oled, &config) != SSD1309_OK)
+    {
+        fprintf(stderr, "ssd1309_Init failed\n");
+        return 1;
+    }
+
+    bench_Run(&oled);
+
+    return 0;
+}
+#endif
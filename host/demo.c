@@ -0,0 +1,249 @@
+/**
+ * Host demo: draws the screens of example/example.c through the emulator
+ * transport, compares the glass with the screenbuffer and dumps every
+ * screen as PBM and PGM.
+ *
+ * Usage: demo [output directory]
+ */
+
+#include <stdio.h>
+
+#include "ssd1309.h"
+#include "ssd1309_emu.h"
+#include "example_bitmaps.h"
+
+#define DEMO_WIDTH      SSD1309_WIDTH
+#define DEMO_HEIGHT     SSD1309_HEIGHT
+
+static SSD1309_Emu_t m_emu;
+static SSD1309_t m_oled;
+static uint8_t m_oled_buffer[SSD1309_BUFFER_BYTES(DEMO_WIDTH, DEMO_HEIGHT)];
+static uint8_t m_oled_shadow[DEMO_WIDTH * DEMO_HEIGHT / 8];
+
+static const char *m_output = ".";
+static int m_screen;
+static int m_mismatches;
+
+
+/* Pixels of the glass that differ from the screenbuffer */
+static uint32_t demo_compare(void)
+{
+    uint32_t bad = 0;
+    bool flip    = (m_oled.Rotation == ROTATION_180) || (m_oled.Rotation == ROTATION_270);
+
+    for (uint8_t y = 0; y < m_oled.Height; y++)
+    {
+        /* The start line moves the display RAM rows on the glass, 180 degrees turns them */
+        uint8_t row = ((flip ? (m_oled.Height - 1 - y) : y) + m_oled.StartLine) % 64;
+
+        for (uint8_t x = 0; x < SSD1309_COLUMNS; x++)
+        {
+            /* Only as written under the current segment remap, a picture left */
+            /* in the display RAM from before a flip shows as a mismatch       */
+            int16_t column = (flip ? (SSD1309_COLUMNS - 1 - x) : x) - m_oled.OffsetX;
+            bool pixel;
+
+            if ((column < 0) || (column >= m_oled.Width))
+            {
+                continue;
+            }
+
+            pixel = (m_oled.Buffer[column + (row / 8) * m_oled.Width] >> (row % 8)) & 0x01;
+            if (pixel != ssd1309_EmuGetPixel(&m_emu, x, y))
+            {
+                bad++;
+            }
+        }
+    }
+
+    return bad;
+}
+
+
+/* Flush the screen, report the bus traffic since the last one, check and dump it */
+static void demo_show(const char *name)
+{
+    char path[256];
+    uint32_t bad;
+
+    ssd1309_UpdateScreen(&m_oled);
+
+    bad = demo_compare();
+    m_mismatches += (bad != 0);
+
+    printf("%-12s %5u command bytes %5u data bytes %3u transactions %s\n", name,
+           m_emu.CommandBytes, m_emu.DataBytes, m_emu.Transactions, (bad != 0) ? "MISMATCH" : "ok");
+
+    snprintf(path, sizeof(path), "%s/screen_%d_%s.pbm", m_output, m_screen, name);
+    ssd1309_EmuWritePBM(&m_emu, path);
+    snprintf(path, sizeof(path), "%s/screen_%d_%s.pgm", m_output, m_screen, name);
+    ssd1309_EmuWritePGM(&m_emu, path);
+
+    ssd1309_EmuClearCounters(&m_emu);
+    m_screen++;
+}
+
+
+int main(int argc, char **argv)
+{
+    SSD1309_VERTEX loc_vertex[] =
+    {
+        {35, 40},
+        {40, 20},
+        {45, 28},
+        {50, 10},
+        {45, 16},
+        {50, 10},
+        {53, 16}
+    };
+    SSD1309_RECT note = {0, 68, 63, 127};
+    SSD1309_RECT list = {0, 12, DEMO_WIDTH - 1, DEMO_HEIGHT - 1};
+    char *menu[]      = {"Display", "Sound", "Bluetooth", "Battery", "About"};
+    SSD1309_Config_t oled_config =
+    {
+        .Width      = DEMO_WIDTH,
+        .Height     = DEMO_HEIGHT,
+        .OffsetX    = SSD1309_OFFSET_X,
+        .OffsetY    = SSD1309_OFFSET_Y,
+        .Buffer     = m_oled_buffer,
+        .Shadow     = m_oled_shadow,
+#if defined(SSD1309_USE_I2C)
+        .CommHandle = ssd1309_EmuI2cHandle,
+        .Address    = SSD1309_I2C_ADDR,
+#elif defined(SSD1309_USE_SPI)
+        .CommHandle = ssd1309_EmuSpiHandle,
+#endif
+    };
+
+    if (argc > 1)
+    {
+        m_output = argv[1];
+    }
+
+    ssd1309_EmuReset(&m_emu);
+    ssd1309_EmuSelect(&m_emu);
+
+    if (ssd1309_Init(&m_oled, &oled_config) != SSD1309_OK)
+    {
+        fprintf(stderr, "ssd1309_Init failed\n");
+        return 1;
+    }
+    demo_show("init");
+
+    /* Splash streamed past the screenbuffer to controller column 0: drawing */
+    /* the same picture afterwards finds the shadow equal and sends nothing  */
+    if (ssd1309_StreamImage(&m_oled, -SSD1309_OFFSET_X, 0, &garfield_128x64_rle) != SSD1309_OK)
+    {
+        fprintf(stderr, "ssd1309_StreamImage failed\n");
+        m_mismatches++;
+    }
+    ssd1309_DrawPageBitmap(&m_oled, -SSD1309_OFFSET_X, 0, &garfield_128x64_page, SSD1309_ROP_COPY);
+    demo_show("splash");
+
+    ssd1309_Fill(&m_oled, Black);
+    ssd1309_WriteSymbol(&m_oled, BLE, 32, 0);
+    ssd1309_SetCursor(&m_oled, 0, 32);
+    ssd1309_WriteString(&m_oled, "Testing 123!!", Font_7x10, White);
+    demo_show("text");
+
+    ssd1309_Fill(&m_oled, Black);
+    ssd1309_Polyline(&m_oled, loc_vertex, sizeof(loc_vertex) / sizeof(loc_vertex[0]), White);
+    ssd1309_DrawArc(&m_oled, 30, 30, 25, 0, 360, White);
+    demo_show("arc");
+
+    ssd1309_DrawPageBitmap(&m_oled, 0, 0, &garfield_128x64_page, SSD1309_ROP_COPY);
+    demo_show("garfield");
+
+    ssd1309_Fill(&m_oled, Black);
+    ssd1309_DrawPageBitmap(&m_oled, 32, 0, &github_logo_64x64_page, SSD1309_ROP_OR);
+    demo_show("logo");
+
+    ssd1309_Fill(&m_oled, White);
+    ssd1309_DrawPageBitmap(&m_oled, 32, 0, &github_logo_64x64_page, SSD1309_ROP_CLEAR);
+    demo_show("logo_inv");
+
+    ssd1309_Fill(&m_oled, Black);
+    for (uint32_t delta = 0; delta < 5; delta++)
+    {
+        ssd1309_DrawCircle(&m_oled, 20 * delta + 30, 15, 10, White);
+    }
+    demo_show("circles");
+
+    ssd1309_Fill(&m_oled, Black);
+    for (uint32_t delta = 0; delta < 5; delta++)
+    {
+        ssd1309_DrawRectangle(&m_oled, 1 + (5 * delta), 1 + (5 * delta),
+                              DEMO_WIDTH - 1 - (5 * delta), DEMO_HEIGHT - 1 - (5 * delta), White);
+    }
+    demo_show("rectangles");
+
+    ssd1309_SetCursor(&m_oled, 30, 28);
+    ssd1309_WriteString(&m_oled, "12:00", Font_11x18, White);
+    demo_show("clock");
+
+    ssd1309_SetCursor(&m_oled, 30, 28);
+    ssd1309_WriteString(&m_oled, "12:01", Font_11x18, White);
+    demo_show("tick");
+
+    ssd1309_SetContrast(&m_oled, 0x40);
+    demo_show("dimmed");
+
+    /* The panel on its side: 64 columns, rows down the long edge */
+    ssd1309_SetRotation(&m_oled, ROTATION_90);
+    ssd1309_Fill(&m_oled, Black);
+    ssd1309_DrawPageBitmap(&m_oled, 0, 0, &github_logo_64x64_page, SSD1309_ROP_OR);
+    ssd1309_DrawText(&m_oled, &note, "Battery low, connect the charger", &FontProp_7x10,
+                     SSD1309_ALIGN_CENTER, SSD1309_WRAP_WORD, White);
+    demo_show("portrait");
+
+    /* The same screen turned over by the panel: the rows turn at once, the */
+    /* columns only once the screenbuffer is sent again under the new remap */
+    ssd1309_SetRotation(&m_oled, ROTATION_270);
+    demo_show("portrait_270");
+
+    ssd1309_SetRotation(&m_oled, ROTATION_180);
+    ssd1309_Fill(&m_oled, Black);
+    ssd1309_SetCursor(&m_oled, 0, 32);
+    ssd1309_WriteString(&m_oled, "Testing 123!!", Font_7x10, White);
+    demo_show("upside_down");
+
+    /* A menu scrolled by 7 rows: the list is clipped below its title, */
+    /* the items it cuts are drawn in part                            */
+    ssd1309_SetRotation(&m_oled, ROTATION_0);
+    ssd1309_Fill(&m_oled, Black);
+    ssd1309_SetCursor(&m_oled, 0, 0);
+    ssd1309_WriteText(&m_oled, "Settings", &FontProp_7x10, White);
+    ssd1309_DrawHLine(&m_oled, 0, DEMO_WIDTH - 1, 11, White);
+    ssd1309_PushClip(&m_oled, &list);
+    for (uint8_t item = 0; item < sizeof(menu) / sizeof(menu[0]); item++)
+    {
+        ssd1309_SetOrigin(&m_oled, 0, 12 + 16 * item - 7);
+        ssd1309_DrawRectangle(&m_oled, 2, 1, DEMO_WIDTH - 3, 14, White);
+        ssd1309_SetCursor(&m_oled, 6, 3);
+        ssd1309_WriteString(&m_oled, menu[item], Font_7x10, White);
+    }
+    ssd1309_PopClip(&m_oled);
+    demo_show("list");
+
+    /* The selection inverted in place: only the rows of the items go out, */
+    /* inverting an item again restores it                                */
+    ssd1309_PushClip(&m_oled, &list);
+    ssd1309_FillRectangle(&m_oled, 3, 12 + 16 * 1 - 7 + 2, DEMO_WIDTH - 4, 12 + 16 * 1 - 7 + 13, Inverse);
+    demo_show("select");
+
+    ssd1309_FillRectangle(&m_oled, 3, 12 + 16 * 1 - 7 + 2, DEMO_WIDTH - 4, 12 + 16 * 1 - 7 + 13, Inverse);
+    ssd1309_FillRectangle(&m_oled, 3, 12 + 16 * 2 - 7 + 2, DEMO_WIDTH - 4, 12 + 16 * 2 - 7 + 13, Inverse);
+    ssd1309_PopClip(&m_oled);
+    demo_show("select_next");
+
+    /* A gauge at two thirds of its 270 degree scale and a pie chart, */
+    /* angles start at the bottom and grow through the right side     */
+    ssd1309_Fill(&m_oled, Black);
+    ssd1309_DrawArc(&m_oled, 34, 34, 28, 45, 315, White);
+    ssd1309_FillRing(&m_oled, 34, 34, 25, 6, 135, 315, White);
+    ssd1309_FillPie(&m_oled, 98, 32, 20, 0, 130, White);
+    ssd1309_DrawArcWithRadiusLine(&m_oled, 98, 32, 20, 130, 360, White);
+    demo_show("gauge");
+
+    return (m_mismatches != 0) ? 1 : 0;
+}
@@ -0,0 +1,492 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "ssd1309_emu.h"
+
+/* Transport call types of ssd1309_spi_handle */
+#define EMU_OLED_RESET          0
+#define EMU_OLED_WRITE_DATA     1
+#define EMU_OLED_WRITE_COMMAND  2
+
+/* Frames between two scroll steps, indexed by the time interval setting */
+static const uint16_t ssd1309_EmuScrollFrames[8] = {5, 64, 128, 256, 3, 4, 25, 2};
+
+/* Emulator fed by the transport handles */
+static SSD1309_Emu_t *ssd1309_EmuSelected;
+
+
+/* Number of parameter bytes following a command */
+static uint8_t ssd1309_EmuParameters(uint8_t command)
+{
+    switch (command)
+    {
+        case 0x20: /* Memory addressing mode */
+        case 0x81: /* Contrast */
+        case 0xA8: /* Multiplex ratio */
+        case 0xD3: /* Display offset */
+        case 0xD5: /* Clock divide */
+        case 0xD9: /* Pre-charge */
+        case 0xDA: /* COM pins */
+        case 0xDB: /* VCOMH */
+        case 0x8D: /* Charge pump */
+        case 0xFD: /* Command lock */
+            return 1;
+
+        case 0x21: /* Column window */
+        case 0x22: /* Page window */
+        case 0xA3: /* Vertical scroll area */
+            return 2;
+
+        case 0x26: /* Right horizontal scroll */
+        case 0x27: /* Left horizontal scroll */
+            return 6;
+
+        case 0x29: /* Vertical and right horizontal scroll */
+        case 0x2A: /* Vertical and left horizontal scroll */
+            return 7;
+
+        default:
+            return 0;
+    }
+}
+
+
+/* Execute a complete command */
+static void ssd1309_EmuCommand(SSD1309_Emu_t *emu, const uint8_t *cmd)
+{
+    uint8_t c = cmd[0];
+
+    if (c <= 0x0F)
+    {
+        emu->Column = (emu->Column & 0xF0) | (c & 0x0F);
+    }
+    else if (c <= 0x1F)
+    {
+        emu->Column = (emu->Column & 0x0F) | ((c & 0x07) << 4);
+    }
+    else if ((c >= 0x40) && (c <= 0x7F))
+    {
+        emu->StartLine = c & 0x3F;
+    }
+    else if ((c >= 0xB0) && (c <= 0xB7))
+    {
+        emu->Page = c & 0x07;
+    }
+    else
+    {
+        switch (c)
+        {
+            case 0x20: emu->Addressing = cmd[1] & 0x03; break;
+            case 0x21:
+                emu->ColumnStart = cmd[1] & 0x7F;
+                emu->ColumnEnd   = cmd[2] & 0x7F;
+                emu->Column      = emu->ColumnStart;
+                break;
+            case 0x22:
+                emu->PageStart = cmd[1] & 0x07;
+                emu->PageEnd   = cmd[2] & 0x07;
+                emu->Page      = emu->PageStart;
+                break;
+            case 0x81: emu->Contrast = cmd[1]; break;
+            case 0xA0: emu->SegmentRemap = false; break;
+            case 0xA1: emu->SegmentRemap = true; break;
+            case 0xA4: emu->EntireOn = false; break;
+            case 0xA5: emu->EntireOn = true; break;
+            case 0xA6: emu->Inverse = false; break;
+            case 0xA7: emu->Inverse = true; break;
+            case 0xA8: emu->Multiplex = (cmd[1] & 0x3F); break;
+            case 0xAE: emu->DisplayOn = false; break;
+            case 0xAF: emu->DisplayOn = true; break;
+            case 0xC0: emu->ComReversed = false; break;
+            case 0xC8: emu->ComReversed = true; break;
+            case 0xD3: emu->DisplayOffset = cmd[1] & 0x3F; break;
+            case 0xA3:
+                emu->ScrollAreaTop  = cmd[1] & 0x3F;
+                emu->ScrollAreaRows = cmd[2] & 0x7F;
+                break;
+            case 0x26:
+            case 0x27:
+                emu->ScrollCommand     = c;
+                emu->ScrollHorizontal  = 1;
+                emu->ScrollStartPage   = cmd[2] & 0x07;
+                emu->ScrollInterval    = cmd[3] & 0x07;
+                emu->ScrollEndPage     = cmd[4] & 0x07;
+                emu->ScrollVertical    = 0;
+                emu->ScrollStartColumn = cmd[5] & 0x7F;
+                emu->ScrollEndColumn   = cmd[6] & 0x7F;
+                break;
+            case 0x29:
+            case 0x2A:
+                emu->ScrollCommand     = c;
+                emu->ScrollHorizontal  = cmd[1] & 0x01;
+                emu->ScrollStartPage   = cmd[2] & 0x07;
+                emu->ScrollInterval    = cmd[3] & 0x07;
+                emu->ScrollEndPage     = cmd[4] & 0x07;
+                emu->ScrollVertical    = cmd[5] & 0x3F;
+                emu->ScrollStartColumn = cmd[6] & 0x7F;
+                emu->ScrollEndColumn   = cmd[7] & 0x7F;
+                break;
+            case 0x2E:
+                emu->ScrollActive = false;
+                emu->ScrollRow    = 0;
+                break;
+            case 0x2F:
+                emu->ScrollActive = true;
+                emu->ScrollFrames = 0;
+                emu->ScrollRow    = 0;
+                break;
+            case 0xD5: case 0xD9: case 0xDA: case 0xDB: case 0x8D: case 0xFD:
+            case 0xFF: case 0xE3:
+                /* Analog settings and NOP */
+                break;
+            default:
+                emu->UnknownCommands++;
+                break;
+        }
+    }
+}
+
+
+/* Store one data byte and advance the address pointers. The segment remap only */
+/* maps the column address of data written after it, the RAM keeps what it has  */
+static void ssd1309_EmuData(SSD1309_Emu_t *emu, uint8_t byte)
+{
+    uint8_t column = emu->Column & 0x7F;
+
+    emu->Gddram[emu->Page & 0x07][emu->SegmentRemap ? column : (SSD1309_EMU_COLUMNS - 1 - column)] = byte;
+
+    switch (emu->Addressing)
+    {
+        case 0x00: /* Horizontal */
+            if (emu->Column >= emu->ColumnEnd)
+            {
+                emu->Column = emu->ColumnStart;
+                emu->Page = (emu->Page >= emu->PageEnd) ? emu->PageStart : (emu->Page + 1);
+            }
+            else
+            {
+                emu->Column++;
+            }
+            break;
+
+        case 0x01: /* Vertical */
+            if (emu->Page >= emu->PageEnd)
+            {
+                emu->Page = emu->PageStart;
+                emu->Column = (emu->Column >= emu->ColumnEnd) ? emu->ColumnStart : (emu->Column + 1);
+            }
+            else
+            {
+                emu->Page++;
+            }
+            break;
+
+        default: /* Page: the column wraps inside the page */
+            emu->Column = (emu->Column >= (SSD1309_EMU_COLUMNS - 1)) ? 0 : (emu->Column + 1);
+            break;
+    }
+}
+
+
+/* Power-on reset state */
+void ssd1309_EmuReset(SSD1309_Emu_t *emu)
+{
+    memset(emu, 0, sizeof(*emu));
+
+    emu->Addressing  = 0x02;
+    emu->ColumnEnd   = SSD1309_EMU_COLUMNS - 1;
+    emu->PageEnd     = SSD1309_EMU_PAGES - 1;
+    emu->Multiplex   = SSD1309_EMU_ROWS - 1;
+    emu->Contrast    = 0x7F;
+    emu->ScrollAreaRows = SSD1309_EMU_ROWS;
+    emu->ScrollEndColumn = SSD1309_EMU_COLUMNS - 1;
+}
+
+
+/* Feed command or data bytes */
+void ssd1309_EmuWrite(SSD1309_Emu_t *emu, bool data, const uint8_t *buffer, size_t size)
+{
+    emu->Transactions++;
+
+    if (data)
+    {
+        emu->DataTransactions++;
+        emu->DataBytes += size;
+
+        for (size_t i = 0; i < size; i++)
+        {
+            ssd1309_EmuData(emu, buffer[i]);
+        }
+        return;
+    }
+
+    emu->CommandBytes += size;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        if (emu->CommandLength == 0)
+        {
+            emu->CommandExpected = ssd1309_EmuParameters(buffer[i]);
+        }
+
+        emu->Command[emu->CommandLength++] = buffer[i];
+
+        if (emu->CommandLength > emu->CommandExpected)
+        {
+            ssd1309_EmuCommand(emu, emu->Command);
+            emu->CommandLength = 0;
+        }
+    }
+}
+
+
+/* Feed one SPI transport call */
+void ssd1309_EmuSpi(SSD1309_Emu_t *emu, uint8_t type, const uint8_t *buffer, size_t size)
+{
+    switch (type)
+    {
+        case EMU_OLED_RESET:
+            ssd1309_EmuReset(emu);
+            break;
+
+        case EMU_OLED_WRITE_COMMAND:
+            ssd1309_EmuWrite(emu, false, buffer, size);
+            break;
+
+        case EMU_OLED_WRITE_DATA:
+            ssd1309_EmuWrite(emu, true, buffer, size);
+            break;
+
+        default:
+            break;
+    }
+}
+
+
+/* Feed one I2C write, control bytes included */
+void ssd1309_EmuI2c(SSD1309_Emu_t *emu, const uint8_t *buffer, size_t size)
+{
+    uint32_t transactions = emu->Transactions;
+    size_t i = 0;
+
+    while (i < size)
+    {
+        uint8_t control = buffer[i++];
+        bool data = (control & 0x40) != 0;
+
+        if (control & 0x80)
+        {
+            /* Co = 1: a single byte follows, then another control byte */
+            if (i < size)
+            {
+                ssd1309_EmuWrite(emu, data, &buffer[i], 1);
+                i++;
+            }
+        }
+        else
+        {
+            /* Co = 0: the rest of the write is a stream */
+            ssd1309_EmuWrite(emu, data, &buffer[i], size - i);
+            i = size;
+        }
+    }
+
+    /* A write is one transaction however it was split */
+    emu->Transactions = transactions + 1;
+}
+
+
+/* Rotate the scrolled columns of the scrolled pages by one */
+static void ssd1309_EmuScrollColumns(SSD1309_Emu_t *emu)
+{
+    uint8_t first = emu->ScrollStartColumn;
+    uint8_t last  = emu->ScrollEndColumn;
+    bool right = (emu->ScrollCommand == 0x26) || (emu->ScrollCommand == 0x29);
+
+    if (last <= first)
+    {
+        return;
+    }
+
+    for (uint8_t page = emu->ScrollStartPage; page <= emu->ScrollEndPage; page++)
+    {
+        uint8_t *row = emu->Gddram[page];
+
+        if (right)
+        {
+            uint8_t carry = row[last];
+            memmove(&row[first + 1], &row[first], last - first);
+            row[first] = carry;
+        }
+        else
+        {
+            uint8_t carry = row[first];
+            memmove(&row[first], &row[first + 1], last - first);
+            row[last] = carry;
+        }
+    }
+}
+
+
+/* Select the emulator fed by the transport handles */
+void ssd1309_EmuSelect(SSD1309_Emu_t *emu)
+{
+    ssd1309_EmuSelected = emu;
+}
+
+
+/* SPI transport handle */
+void ssd1309_EmuSpiHandle(uint8_t type, uint8_t *buffer, size_t size)
+{
+    if (NULL != ssd1309_EmuSelected)
+    {
+        ssd1309_EmuSpi(ssd1309_EmuSelected, type, buffer, size);
+    }
+}
+
+
+/* I2C transport handle, every address reaches the selected emulator */
+void ssd1309_EmuI2cHandle(uint8_t address, uint8_t *buffer, size_t size)
+{
+    (void)address;
+
+    if (NULL != ssd1309_EmuSelected)
+    {
+        ssd1309_EmuI2c(ssd1309_EmuSelected, buffer, size);
+    }
+}
+
+
+/* Advance the hardware scrolling by a number of frames */
+void ssd1309_EmuStep(SSD1309_Emu_t *emu, uint32_t frames)
+{
+    uint16_t interval = ssd1309_EmuScrollFrames[emu->ScrollInterval & 0x07];
+
+    if (!emu->ScrollActive)
+    {
+        return;
+    }
+
+    while (frames-- > 0)
+    {
+        emu->ScrollFrames++;
+
+        if ((emu->ScrollFrames % interval) != 0)
+        {
+            continue;
+        }
+
+        if (emu->ScrollHorizontal)
+        {
+            ssd1309_EmuScrollColumns(emu);
+        }
+
+        if ((emu->ScrollVertical != 0) && (emu->ScrollAreaRows != 0))
+        {
+            emu->ScrollRow = (emu->ScrollRow + emu->ScrollVertical) % emu->ScrollAreaRows;
+        }
+    }
+}
+
+
+/* Visible height in rows */
+uint8_t ssd1309_EmuHeight(const SSD1309_Emu_t *emu)
+{
+    return emu->Multiplex + 1;
+}
+
+
+/* Pixel as seen on the glass */
+bool ssd1309_EmuGetPixel(const SSD1309_Emu_t *emu, uint8_t x, uint8_t y)
+{
+    uint8_t com;
+    uint8_t row;
+    bool pixel;
+
+    if (!emu->DisplayOn || (x >= SSD1309_EMU_COLUMNS) || (y > emu->Multiplex))
+    {
+        return false;
+    }
+
+    if (emu->EntireOn)
+    {
+        return true;
+    }
+
+    /* The COM scan direction applies at once, unlike the segment remap */
+    com = emu->ComReversed ? y : (emu->Multiplex - y);
+
+    /* Vertical scrolling moves the rows of the scroll area */
+    if ((emu->ScrollRow != 0) && (com >= emu->ScrollAreaTop) &&
+        (com < (emu->ScrollAreaTop + emu->ScrollAreaRows)))
+    {
+        com = emu->ScrollAreaTop + ((com - emu->ScrollAreaTop + emu->ScrollRow) % emu->ScrollAreaRows);
+    }
+
+    row   = (com + emu->StartLine + emu->DisplayOffset) % SSD1309_EMU_ROWS;
+    pixel = (emu->Gddram[row / 8][x] >> (row % 8)) & 0x01;
+
+    return pixel != emu->Inverse;
+}
+
+
+/* Clear the bus counters */
+void ssd1309_EmuClearCounters(SSD1309_Emu_t *emu)
+{
+    emu->CommandBytes     = 0;
+    emu->DataBytes        = 0;
+    emu->Transactions     = 0;
+    emu->DataTransactions = 0;
+}
+
+
+/* Dump the glass as a plain PBM */
+int ssd1309_EmuWritePBM(const SSD1309_Emu_t *emu, const char *path)
+{
+    FILE *file = fopen(path, "w");
+    uint8_t height = ssd1309_EmuHeight(emu);
+
+    if (NULL == file)
+    {
+        return -1;
+    }
+
+    fprintf(file, "P1\n%d %d\n", SSD1309_EMU_COLUMNS, height);
+
+    for (uint8_t y = 0; y < height; y++)
+    {
+        for (uint8_t x = 0; x < SSD1309_EMU_COLUMNS; x++)
+        {
+            fputc(ssd1309_EmuGetPixel(emu, x, y) ? '1' : '0', file);
+            fputc((x == (SSD1309_EMU_COLUMNS - 1)) ? '\n' : ' ', file);
+        }
+    }
+
+    return fclose(file);
+}
+
+
+/* Dump the glass as a plain PGM, lit pixels at the contrast level */
+int ssd1309_EmuWritePGM(const SSD1309_Emu_t *emu, const char *path)
+{
+    FILE *file = fopen(path, "w");
+    uint8_t height = ssd1309_EmuHeight(emu);
+
+    if (NULL == file)
+    {
+        return -1;
+    }
+
+    fprintf(file, "P2\n%d %d\n255\n", SSD1309_EMU_COLUMNS, height);
+
+    for (uint8_t y = 0; y < height; y++)
+    {
+        for (uint8_t x = 0; x < SSD1309_EMU_COLUMNS; x++)
+        {
+            fprintf(file, "%d%c", ssd1309_EmuGetPixel(emu, x, y) ? emu->Contrast : 0,
+                    (x == (SSD1309_EMU_COLUMNS - 1)) ? '\n' : ' ');
+        }
+    }
+
+    return fclose(file);
+}
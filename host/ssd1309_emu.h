@@ -0,0 +1,109 @@
+/**
+ * Host-side SSD1309 panel emulator.
+ *
+ * Interprets the command and data stream the driver puts on the bus
+ * (addressing modes, page/column pointers, remap, start line, scroll,
+ * contrast) into a simulated GDDRAM, so rendering and flush changes can
+ * be checked bit-exactly on a Linux box.
+ */
+
+#ifndef __SSD1309_EMU_H__
+#define __SSD1309_EMU_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Display RAM of the controller */
+#define SSD1309_EMU_COLUMNS     128
+#define SSD1309_EMU_PAGES       8
+#define SSD1309_EMU_ROWS        (SSD1309_EMU_PAGES * 8)
+
+typedef struct
+{
+    /* Display RAM, in the order of the segments, and its address pointers */
+    uint8_t Gddram[SSD1309_EMU_PAGES][SSD1309_EMU_COLUMNS];
+    uint8_t Addressing;
+    uint8_t Page;
+    uint8_t Column;
+    uint8_t ColumnStart;
+    uint8_t ColumnEnd;
+    uint8_t PageStart;
+    uint8_t PageEnd;
+
+    /* Display configuration */
+    uint8_t StartLine;
+    uint8_t DisplayOffset;
+    uint8_t Multiplex;
+    uint8_t Contrast;
+    bool SegmentRemap;
+    bool ComReversed;
+    bool Inverse;
+    bool EntireOn;
+    bool DisplayOn;
+
+    /* Scrolling */
+    bool ScrollActive;
+    uint8_t ScrollCommand;
+    uint8_t ScrollHorizontal;
+    uint8_t ScrollStartPage;
+    uint8_t ScrollEndPage;
+    uint8_t ScrollInterval;
+    uint8_t ScrollVertical;
+    uint8_t ScrollStartColumn;
+    uint8_t ScrollEndColumn;
+    uint8_t ScrollAreaTop;
+    uint8_t ScrollAreaRows;
+    uint8_t ScrollRow;
+    uint32_t ScrollFrames;
+
+    /* Command being parsed */
+    uint8_t Command[8];
+    uint8_t CommandLength;
+    uint8_t CommandExpected;
+
+    /* Bus accounting */
+    uint32_t CommandBytes;
+    uint32_t DataBytes;
+    uint32_t Transactions;
+    uint32_t DataTransactions;
+    uint32_t UnknownCommands;
+} SSD1309_Emu_t;
+
+/* Power-on reset state */
+void ssd1309_EmuReset(SSD1309_Emu_t *emu);
+
+/* Feed command or data bytes, as the DC pin selects on SPI */
+void ssd1309_EmuWrite(SSD1309_Emu_t *emu, bool data, const uint8_t *buffer, size_t size);
+
+/* Feed one SPI transport call (OLED_RESET/OLED_WRITE_COMMAND/OLED_WRITE_DATA) */
+void ssd1309_EmuSpi(SSD1309_Emu_t *emu, uint8_t type, const uint8_t *buffer, size_t size);
+
+/* Feed one I2C write: control byte(s) followed by commands or data */
+void ssd1309_EmuI2c(SSD1309_Emu_t *emu, const uint8_t *buffer, size_t size);
+
+/* Let the panel run for a number of frames (advances hardware scrolling) */
+void ssd1309_EmuStep(SSD1309_Emu_t *emu, uint32_t frames);
+
+/* Pixel as seen on the glass (remap, COM direction, start line, inverse applied) */
+bool ssd1309_EmuGetPixel(const SSD1309_Emu_t *emu, uint8_t x, uint8_t y);
+
+/* Visible height in rows */
+uint8_t ssd1309_EmuHeight(const SSD1309_Emu_t *emu);
+
+/* Clear the bus counters */
+void ssd1309_EmuClearCounters(SSD1309_Emu_t *emu);
+
+/* Emulator fed by the transport handles below */
+void ssd1309_EmuSelect(SSD1309_Emu_t *emu);
+
+/* Transport handles for SSD1309_Config_t.CommHandle (and ssd1309_SetAsyncHandle, */
+/* they complete at once) on SPI and I2C builds                                   */
+void ssd1309_EmuSpiHandle(uint8_t type, uint8_t *buffer, size_t size);
+void ssd1309_EmuI2cHandle(uint8_t address, uint8_t *buffer, size_t size);
+
+/* Dump the glass as a plain PBM, or as a PGM using the contrast as grey level */
+int ssd1309_EmuWritePBM(const SSD1309_Emu_t *emu, const char *path);
+int ssd1309_EmuWritePGM(const SSD1309_Emu_t *emu, const char *path);
+
+#endif /* __SSD1309_EMU_H__ */
@@ -0,0 +1,9 @@
+/**
+ * Host build stand-in for the nRF5 SDK header of the same name.
+ * The driver does not use anything from it.
+ */
+
+#ifndef __HOST_APP_ERROR_H__
+#define __HOST_APP_ERROR_H__
+
+#endif /* __HOST_APP_ERROR_H__ */
@@ -1,559 +1,3344 @@
 #include "ssd1309.h"
 
-static float ssd1309_DegToRad(float par_deg);
-static uint16_t ssd1309_NormalizeTo0_360(uint16_t par_deg);
 
-#if defined(SSD1309_USE_I2C)
-ssd1309_i2c_handle i2c_comm_handle_callback;
+/* Counters of ssd1309_GetStats(), compiled out unless enabled */
+#if defined(SSD1309_ENABLE_STATS)
+#define SSD1309_STATS_SEND(dev, type, size)     ssd1309_StatsSend((dev), (type), (size))
+#define SSD1309_STATS_ADD(dev, counter, count)  ((dev)->Stats.counter += (count))
+
+/* Count one transport call */
+static inline void ssd1309_StatsSend(SSD1309_t *dev, uint8_t type, size_t size)
+{
+    if (type == OLED_WRITE_COMMAND)
+    {
+        dev->Stats.CommandBytes += size;
+    }
+    else
+    {
+        dev->Stats.DataBytes += size;
+    }
 
-void ssd1309_Reset(void) 
+    dev->Stats.Transactions++;
+}
+#else
+#define SSD1309_STATS_SEND(dev, type, size)
+#define SSD1309_STATS_ADD(dev, counter, count)
+#endif
+
+#if defined(SSD1309_USE_I2C)
+void ssd1309_Reset(SSD1309_t *dev) 
 {
     /* for I2C - do nothing */
+    (void)dev;
 }
 
-/* Send a byte to the command register */
-void ssd1309_WriteCommand(uint8_t byte) 
+/* Send a copy of the bytes behind a control byte, MAX_TX_DATA bytes per transaction */
+static void ssd1309_WriteCopy(SSD1309_t *dev, uint8_t control, const uint8_t *buffer, size_t buff_size)
 {
-    tx_buff tx_buff[3] = {0x00, 0x00, 0x00};
-    buff[2] = byte;
+    uint8_t tx_buff[MAX_TX_SIZE];
+    size_t chunk;
+
+    tx_buff[0] = control;
 
-    if (NULL != i2c_comm_handle_callback)
+    while (buff_size > 0)
     {
-        i2c_comm_handle_callback(SSD1309_I2C_ADDR, tx_buff, MAX_ADDRESS_SIZE + 1);
+        chunk = (buff_size > MAX_TX_DATA) ? MAX_TX_DATA : buff_size;
+        memcpy(&tx_buff[MAX_CONTROL_SIZE], buffer, chunk);
+
+        if (NULL != dev->CommHandle)
+        {
+            dev->CommHandle(dev->Address, tx_buff, MAX_CONTROL_SIZE + chunk);
+        }
+        SSD1309_STATS_SEND(dev, (control == SSD1309_I2C_CONTROL_COMMAND) ? OLED_WRITE_COMMAND : OLED_WRITE_DATA, chunk);
+
+        buffer += chunk;
+        buff_size -= chunk;
     }
 }
 
-/* Send datam*/
-void ssd1309_WriteData(uint8_t* buffer, size_t buff_size) 
+/* Send a byte to the command register */
+void ssd1309_WriteCommand(SSD1309_t *dev, uint8_t byte) 
 {
-    uint8_t tx_buff[MAX_TX_SIZE];
-    memset(tx_buff, 0, MAX_TX_SIZE);
+    ssd1309_WriteCopy(dev, SSD1309_I2C_CONTROL_COMMAND, &byte, 1);
+}
 
-    if (buff_size > MAX_TX_DATA)
-    {
-	return;
-    }
+/* Send a sequence of commands */
+void ssd1309_WriteCommands(SSD1309_t *dev, const uint8_t *cmds, size_t n)
+{
+    ssd1309_WriteCopy(dev, SSD1309_I2C_CONTROL_COMMAND, cmds, n);
+}
+
+/* Send data */
+void ssd1309_WriteData(SSD1309_t *dev, uint8_t* buffer, size_t buff_size) 
+{
+    ssd1309_WriteCopy(dev, SSD1309_I2C_CONTROL_DATA, buffer, buff_size);
+}
+
+/* Register the handle used by ssd1309_UpdateScreenAsync */
+void ssd1309_SetAsyncHandle(SSD1309_t *dev, ssd1309_i2c_handle i2c_async_handle)
+{
+    dev->AsyncHandle = i2c_async_handle;
+}
+
+/* Hand a command or data transfer to the transport. Every buffer the driver
+ * sends keeps one byte of headroom, so the control byte is written in front
+ * of the bytes instead of copying them; ssd1309_TransmitDone() puts the
+ * replaced byte back once the transfer is over. */
+static void ssd1309_Transmit(SSD1309_t *dev, uint8_t type, uint8_t *buffer, size_t buff_size, bool async)
+{
+    ssd1309_i2c_handle handle = async ? dev->AsyncHandle : dev->CommHandle;
 
-    memcpy(&tx_buff[2], buffer, buff_size);
+    dev->ControlPosition  = buffer - MAX_CONTROL_SIZE;
+    dev->ControlSaved     = *dev->ControlPosition;
+    *dev->ControlPosition = (type == OLED_WRITE_COMMAND) ? SSD1309_I2C_CONTROL_COMMAND : SSD1309_I2C_CONTROL_DATA;
 
-    if (NULL != i2c_comm_handle_callback)
+    if (NULL != handle)
     {
-        i2c_comm_handle_callback(SSD1309_I2C_ADDR, tx_buff, MAX_ADDRESS_SIZE + buff_size);
+        handle(dev->Address, dev->ControlPosition, MAX_CONTROL_SIZE + buff_size);
     }
+    SSD1309_STATS_SEND(dev, type, buff_size);
 }
 
-#elif defined(SSD1309_USE_SPI)
-ssd1309_spi_handle spi_comm_handle_callback;
+static void ssd1309_TransmitDone(SSD1309_t *dev)
+{
+    *dev->ControlPosition = dev->ControlSaved;
+}
 
-void ssd1309_Reset(void) 
+#elif defined(SSD1309_USE_SPI)
+void ssd1309_Reset(SSD1309_t *dev) 
 {
-    if (NULL != spi_comm_handle_callback)
+    if (NULL != dev->CommHandle)
     {
-        spi_comm_handle_callback(OLED_RESET, NULL, 0);
+        dev->CommHandle(OLED_RESET, NULL, 0);
     }
 }
 
 /* Send a byte to the command register */
-void ssd1309_WriteCommand(uint8_t byte) 
+void ssd1309_WriteCommand(SSD1309_t *dev, uint8_t byte) 
 {
-    if (NULL != spi_comm_handle_callback)
+    if (NULL != dev->CommHandle)
     {
-        spi_comm_handle_callback(OLED_WRITE_COMMAND, (uint8_t *)&byte, 1);
+        dev->CommHandle(OLED_WRITE_COMMAND, (uint8_t *)&byte, 1);
     }
+    SSD1309_STATS_SEND(dev, OLED_WRITE_COMMAND, 1);
+}
+
+/* Send a sequence of commands in one transaction */
+void ssd1309_WriteCommands(SSD1309_t *dev, const uint8_t *cmds, size_t n)
+{
+    if (NULL != dev->CommHandle)
+    {
+        dev->CommHandle(OLED_WRITE_COMMAND, (uint8_t *)cmds, n);
+    }
+    SSD1309_STATS_SEND(dev, OLED_WRITE_COMMAND, n);
 }
 
 /* Send data */
-void ssd1309_WriteData(uint8_t *buffer, size_t buff_size) 
+void ssd1309_WriteData(SSD1309_t *dev, uint8_t *buffer, size_t buff_size) 
+{
+    if (NULL != dev->CommHandle)
+    {
+        dev->CommHandle(OLED_WRITE_DATA, buffer, buff_size);
+    }
+    SSD1309_STATS_SEND(dev, OLED_WRITE_DATA, buff_size);
+}
+
+/* Register the handle used by ssd1309_UpdateScreenAsync */
+void ssd1309_SetAsyncHandle(SSD1309_t *dev, ssd1309_spi_handle spi_async_handle)
+{
+    dev->AsyncHandle = spi_async_handle;
+}
+
+/* Hand a command or data transfer to the synchronous or asynchronous handle */
+static void ssd1309_Transmit(SSD1309_t *dev, uint8_t type, uint8_t *buffer, size_t buff_size, bool async)
 {
-    if (NULL != spi_comm_handle_callback)
+    ssd1309_spi_handle handle = async ? dev->AsyncHandle : dev->CommHandle;
+
+    if (NULL != handle)
     {
-        spi_comm_handle_callback(OLED_WRITE_DATA, buffer, buff_size);
+        handle(type, buffer, buff_size);
     }
+    SSD1309_STATS_SEND(dev, type, buff_size);
+}
+
+static void ssd1309_TransmitDone(SSD1309_t *dev)
+{
+    /* Nothing to do */
+    (void)dev;
 }
 
 #else
 #error "You should define SSD1309_USE_SPI or SSD1309_USE_I2C macro"
 #endif
 
-/* Screenbuffer */
-static uint8_t SSD1309_Buffer[SSD1309_BUFFER_SIZE];
+#if defined(SSD1309_USE_I2C)
+#define SSD1309_MAX_TRANSFER_SIZE   (SSD1309_I2C_MAX_TRANSFER - MAX_CONTROL_SIZE)
+#else
+#define SSD1309_MAX_TRANSFER_SIZE   (SSD1309_COLUMNS * SSD1309_MAX_PAGES)
+#endif
+
+/* Gathered updates and streamed images go out a scratch buffer at a time, */
+/* in pieces the transport takes at once                                   */
+#define SSD1309_STREAM_CHUNK_SIZE   ((SSD1309_FLUSH_SCRATCH_SIZE < SSD1309_MAX_TRANSFER_SIZE) ? \
+                                     SSD1309_FLUSH_SCRATCH_SIZE : SSD1309_MAX_TRANSFER_SIZE)
 
-/* Screen object */
-static SSD1309_t SSD1309;
+/* COM lines of the controller, the largest vertical scroll area */
+#define SSD1309_MAX_MUX             64
 
+/* Screenbuffer columns that land inside the controller RAM */
+#define SSD1309_VISIBLE_X_MIN(dev)  (((dev)->OffsetX < 0) ? -((dev)->OffsetX) : 0)
+#define SSD1309_VISIBLE_X_MAX(dev)  ((((dev)->Width + (dev)->OffsetX) > SSD1309_COLUMNS) ? \
+                                     (SSD1309_COLUMNS - 1 - ((dev)->OffsetX)) : ((dev)->Width - 1))
 
-/* Fills the Screenbuffer with values from a given buffer of a fixed length */
-SSD1309_Error_t ssd1309_FillBuffer(uint8_t *buf, uint32_t len)
-{
-    SSD1309_Error_t ret = SSD1309_ERR;
+/* 90 and 270 degrees are drawn transposed into the screenbuffer, 180 degrees */
+/* (and the other half of 270) is left to the remap commands of the panel     */
+#define SSD1309_PORTRAIT(dev)           (((dev)->Rotation == ROTATION_90) || ((dev)->Rotation == ROTATION_270))
+#define SSD1309_SCREEN_WIDTH(dev)       (SSD1309_PORTRAIT(dev) ? (dev)->Height : (dev)->Width)
+#define SSD1309_SCREEN_HEIGHT(dev)      (SSD1309_PORTRAIT(dev) ? (dev)->Width : (dev)->Height)
 
-    if (len <= SSD1309_BUFFER_SIZE)
+/* Screenbuffer column of row y of a portrait screen, its x is the screenbuffer row */
+#define SSD1309_PORTRAIT_COLUMN(dev, y) ((dev)->Width - 1 - (y))
+
+
+/* Screenbuffer writes reported to the benchmark hooks */
+#if defined(SSD1309_TRACE)
+#define SSD1309_TRACE_PIXEL(dev, x, y)              ssd1309_TracePixel((dev), (x), (y))
+#define SSD1309_TRACE_BYTES(dev, offset, length)    ssd1309_TraceBytes((dev), (offset), (length))
+#else
+#define SSD1309_TRACE_PIXEL(dev, x, y)
+#define SSD1309_TRACE_BYTES(dev, offset, length)
+#endif
+
+
+/* Bus cost of commands and data in byte times, consecutive commands share a transaction */
+#define SSD1309_COMMAND_COST(count)         ((count) + SSD1309_TRANSACTION_COST)
+#define SSD1309_DATA_COST(bytes, count)     ((bytes) + (count) * SSD1309_TRANSACTION_COST)
+
+/* Extra cost of splitting a page run in two: column address and */
+/* a data transaction, unchanged gaps shorter than this are sent  */
+#define SSD1309_RUN_COST                    (SSD1309_COMMAND_COST(2) + SSD1309_TRANSACTION_COST)
+
+/* Transactions of bytes gathered through the scratch buffer */
+#define SSD1309_GATHER_CHUNKS(bytes)        (((bytes) + SSD1309_STREAM_CHUNK_SIZE - 1) / SSD1309_STREAM_CHUNK_SIZE)
+
+
+/* Record that columns x1..x2 of pages page1..page2 were written */
+static inline void ssd1309_MarkDirty(SSD1309_t *dev, uint8_t x1, uint8_t x2, uint8_t page1, uint8_t page2)
+{
+    for (uint8_t page = page1; page <= page2; page++)
     {
-        memcpy(SSD1309_Buffer, buf, len);
-        ret = SSD1309_OK;
-    }
+        if (x1 < dev->DirtyMin[page])
+        {
+            dev->DirtyMin[page] = x1;
+        }
 
-    return ret;
+        if (x2 > dev->DirtyMax[page])
+        {
+            dev->DirtyMax[page] = x2;
+        }
+    }
 }
 
 
-/* Initialize the oled screen */
-#if defined(SSD1309_USE_I2C)
-void ssd1309_Init(ssd1309_i2c_handle i2c_comm_handle) 
+/* Record that the box x1..x2, y1..y2 of the rotated screen was written */
+static inline void ssd1309_MarkArea(SSD1309_t *dev, uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2)
 {
-    if (NULL != i2c_comm_handle)
+    if (SSD1309_PORTRAIT(dev))
     {
-        i2c_comm_handle_callback = i2c_comm_handle;
+        ssd1309_MarkDirty(dev, SSD1309_PORTRAIT_COLUMN(dev, y2), SSD1309_PORTRAIT_COLUMN(dev, y1), x1 / 8, x2 / 8);
     }
-#elif defined(SSD1309_USE_SPI)
-void ssd1309_Init(ssd1309_spi_handle spi_comm_handle) 
+    else
+    {
+        ssd1309_MarkDirty(dev, x1, x2, y1 / 8, y2 / 8);
+    }
+}
+
+
+/* Mark the whole screenbuffer as changed */
+void ssd1309_Invalidate(SSD1309_t *dev)
 {
-    uint8_t ssd1309_DelayTimeMS = 100;
-    if (NULL != spi_comm_handle)
+    /* The display RAM is unknown, the shadow is reloaded by the next update */
+    dev->ShadowValid = false;
+
+    ssd1309_MarkDirty(dev, 0, dev->Width - 1, 0, dev->Pages - 1);
+}
+
+
+/* Fills the Screenbuffer with values from a given buffer of a fixed length */
+SSD1309_Error_t ssd1309_FillBuffer(SSD1309_t *dev, uint8_t *buf, uint32_t len)
+{
+    SSD1309_Error_t ret = SSD1309_ERR;
+
+    if (len <= ((uint32_t)dev->Width * dev->Pages))
     {
-        spi_comm_handle_callback = spi_comm_handle;
+        memcpy(dev->Buffer, buf, len);
+        SSD1309_TRACE_BYTES(dev, 0, len);
+
+        if (len > 0)
+        {
+            ssd1309_MarkDirty(dev, 0, dev->Width - 1, 0, (len - 1) / dev->Width);
+        }
+
+        ret = SSD1309_OK;
     }
-#endif
-    /* Reset OLED */
-    ssd1309_Reset();
 
-    /* Wait for the screen to boot */
-    spi_comm_handle_callback(OLED_DELAY, &ssd1309_DelayTimeMS, sizeof(uint8_t));
-    
-    /* Init OLED */
-    ssd1309_WriteCommand(0xAE); /* Display off */
+    return ret;
+}
+
 
-    ssd1309_WriteCommand(0x20); /* Set Memory Addressing Mode */   
-    ssd1309_WriteCommand(0x10); /* 00,Horizontal Addressing Mode; 01,Vertical Addressing Mode; */
-                                /* 10,Page Addressing Mode (RESET); 11,Invalid */
+/* Clip to the whole screen, origin in its top left corner, nothing pushed */
+static void ssd1309_ResetView(SSD1309_t *dev)
+{
+    dev->Clip.x1   = 0;
+    dev->Clip.y1   = 0;
+    dev->Clip.x2   = SSD1309_SCREEN_WIDTH(dev) - 1;
+    dev->Clip.y2   = SSD1309_SCREEN_HEIGHT(dev) - 1;
+    dev->OriginX   = 0;
+    dev->OriginY   = 0;
+    dev->ClipDepth = 0;
+}
 
-    ssd1309_WriteCommand(0xB0); /*Set Page Start Address for Page Addressing Mode, 0-7 */
 
+/* COM scan direction and segment re-map of ROTATION_0, both are */
+/* flipped for 180 degrees                                        */
 #ifdef SSD1309_MIRROR_VERT
-    ssd1309_WriteCommand(0xC0); /* Mirror vertically */
+#define SSD1309_COM_SCAN        0xC0    /* Mirror vertically */
 #else
-    ssd1309_WriteCommand(0xC8); /* Set COM Output Scan Direction */
+#define SSD1309_COM_SCAN        0xC8
 #endif
 
-    ssd1309_WriteCommand(0x00); /*---set low column address  */
-    ssd1309_WriteCommand(0x10); /*---set high column address */
-
-    ssd1309_WriteCommand(0x40); /*--set start line address - CHECK */
-
-    ssd1309_WriteCommand(0x81); /*--set contrast control register - CHECK */
-    ssd1309_WriteCommand(0xFF);
-
 #ifdef SSD1309_MIRROR_HORIZ
-    ssd1309_WriteCommand(0xA0); /* Mirror horizontally */
+#define SSD1309_SEGMENT_REMAP   0xA0    /* Mirror horizontally */
 #else
-    ssd1309_WriteCommand(0xA1); /* --set segment re-map 0 to 127 - CHECK */
+#define SSD1309_SEGMENT_REMAP   0xA1
 #endif
 
+/* Initialization sequence, built from ssd1309_conf.h; the height */
+/* dependent commands and display on are appended by ssd1309_Init */
+static const uint8_t SSD1309_InitSequence[] =
+{
+    0xAE,       /* Display off */
+
+    0x20,       /* Set Memory Addressing Mode */
+    0x02,       /* 00,Horizontal Addressing Mode; 01,Vertical Addressing Mode; */
+                /* 10,Page Addressing Mode (RESET); 11,Invalid */
+
+    0xB0,       /* Set Page Start Address for Page Addressing Mode, 0-7 */
+
+    SSD1309_COM_SCAN,       /* Set COM Output Scan Direction */
+
+    0x00,       /*---set low column address  */
+    0x10,       /*---set high column address */
+
+    0x40,       /*--set start line address - CHECK */
+
+    0x81,       /*--set contrast control register - CHECK */
+    0xFF,
+
+    SSD1309_SEGMENT_REMAP,  /* --set segment re-map 0 to 127 - CHECK */
+
 #ifdef SSD1309_INVERSE_COLOR
-    ssd1309_WriteCommand(0xA7); /*--set inverse color */
+    0xA7,       /*--set inverse color */
 #else
-    ssd1309_WriteCommand(0xA6); /*--set normal color */
+    0xA6,       /*--set normal color */
 #endif
 
-/* Set multiplex ratio. */
-#if (SSD1309_HEIGHT == 128)
-    /* Found in the Luma Python lib for SH1106. */
-    ssd1306_WriteCommand(0xFF);
-#else
-    ssd1309_WriteCommand(0xA8); /*--set multiplex ratio(1 to 64) - CHECK */
-#endif
+    0xA4,       /* 0xA4, Output follows RAM content;0xa5,Output ignores RAM content */
 
-#if (SSD1309_HEIGHT == 32)
-    ssd1309_WriteCommand(0x1F);
-#elif (SSD1309_HEIGHT == 64)
-    ssd1309_WriteCommand(0x3F);
-#elif (SSD1309_HEIGHT == 128)
-    ssd1309_WriteCommand(0x3F); /* Seems to work for 128px high displays too. */
-#else
-#error "Only 32, 64, or 128 lines of height are supported!"
+    0xD3,       /*-set display offset - CHECK */
+    0x00,       /*-not offset */
+
+    0xD5,       /*--set display clock divide ratio/oscillator frequency */
+    0xF0,       /*--set divide ratio */
+
+    0xD9,       /*--set pre-charge period */
+    0x22,
+
+    0xDB,       /*--set vcomh */
+    0x20,       /* 0x20, 0.77xVcc */
+
+    0x8D,       /*--set DC-DC enable */
+    0x14
+};
+
+/* Multiplex ratio, COM pins configuration and display on */
+#define SSD1309_INIT_TAIL_SIZE  5
+
+
+/* Initialize the oled screen */
+SSD1309_Error_t ssd1309_Init(SSD1309_t *dev, const SSD1309_Config_t *config)
+{
+    uint8_t commands[sizeof(SSD1309_InitSequence) + SSD1309_INIT_TAIL_SIZE];
+    uint8_t *tail = &commands[sizeof(SSD1309_InitSequence)];
+#if defined(SSD1309_USE_SPI)
+    uint8_t ssd1309_DelayTimeMS = 100;
 #endif
 
-    ssd1309_WriteCommand(0xA4); /* 0xA4, Output follows RAM content;0xa5,Output ignores RAM content */
+    if ((NULL == dev) || (NULL == config) || (NULL == config->Buffer) || (0 == config->Width))
+    {
+        return SSD1309_ERR;
+    }
+
+    if (((config->Height != 32) && (config->Height != 64) && (config->Height != 128)) ||
+        ((config->Height / 8) > SSD1309_MAX_PAGES))
+    {
+        /* Only 32, 64, or 128 lines of height are supported! */
+        return SSD1309_ERR;
+    }
 
-    ssd1309_WriteCommand(0xD3); /*-set display offset - CHECK */
-    ssd1309_WriteCommand(0x00); /*-not offset */
+    memset(dev, 0, sizeof(SSD1309_t));
+    memset(dev->DirtyMin, 0xFF, sizeof(dev->DirtyMin));
 
-    ssd1309_WriteCommand(0xD5); /*--set display clock divide ratio/oscillator frequency */
-    ssd1309_WriteCommand(0xF0); /*--set divide ratio */
+    dev->Width      = config->Width;
+    dev->Height     = config->Height;
+    dev->Pages      = config->Height / 8;
+    dev->OffsetX    = config->OffsetX;
+    dev->OffsetY    = config->OffsetY;
+    dev->CommHandle = config->CommHandle;
+#if defined(SSD1309_USE_I2C)
+    dev->Address    = config->Address;
+#endif
 
-    ssd1309_WriteCommand(0xD9); /*--set pre-charge period */
-    ssd1309_WriteCommand(0x22); /*			  */
+    /* The bytes in front of the screenbuffers take the I2C control byte */
+    dev->Buffer = &config->Buffer[SSD1309_HEADROOM];
+    if (NULL != config->BackBuffer)
+    {
+        dev->FrontBuffer = &config->BackBuffer[SSD1309_HEADROOM];
+    }
+    dev->Shadow = config->Shadow;
 
-    ssd1309_WriteCommand(0xDA); /*--set com pins hardware configuration - CHECK */
-#if (SSD1309_HEIGHT == 32)
-    ssd1309_WriteCommand(0x02);
-#elif (SSD1309_HEIGHT == 64)
-    ssd1309_WriteCommand(0x12);
-#elif (SSD1309_HEIGHT == 128)
-    ssd1309_WriteCommand(0x12);
-#else
-#error "Only 32, 64, or 128 lines of height are supported!"
+    /* Reset OLED */
+    ssd1309_Reset(dev);
+
+#if defined(SSD1309_USE_SPI)
+    /* Wait for the screen to boot */
+    if (NULL != dev->CommHandle)
+    {
+        dev->CommHandle(OLED_DELAY, &ssd1309_DelayTimeMS, sizeof(uint8_t));
+    }
 #endif
 
-    ssd1309_WriteCommand(0xDB); /*--set vcomh */
-    ssd1309_WriteCommand(0x20); /* 0x20, 0.77xVcc */ 
+    /* Set multiplex ratio. */
+    tail[0] = (dev->Height == 128) ? 0xFF : 0xA8;   /* 0xFF found in the Luma Python lib for SH1106. */
+    tail[1] = (dev->Height == 32) ? 0x1F : 0x3F;    /* 0x3F seems to work for 128px high displays too. */
 
-    ssd1309_WriteCommand(0x8D); /*--set DC-DC enable */
-    ssd1309_WriteCommand(0x14); /*                   */
-    ssd1309_WriteCommand(0xAF); /*--turn on SSD1309 panel */
+    /* Set com pins hardware configuration */
+    tail[2] = 0xDA;
+    tail[3] = (dev->Height == 32) ? 0x02 : 0x12;
+
+    tail[4] = 0xAF; /*--turn on SSD1309 panel */
+
+    /* Init OLED */
+    memcpy(commands, SSD1309_InitSequence, sizeof(SSD1309_InitSequence));
+    ssd1309_WriteCommands(dev, commands, sizeof(commands));
+    dev->Addressing = SSD1309_ADDRESSING_PAGE;
+    dev->FlushMode = SSD1309_ADDRESSING_AUTO;
 
     /* Clear screen */
-    ssd1309_Fill(Black);
+    ssd1309_ResetView(dev);
+    ssd1309_Fill(dev, Black);
     
     /* Flush buffer to screen */
-    ssd1309_UpdateScreen();
+    ssd1309_UpdateScreen(dev);
     
     /* Set default values for screen object */
-    SSD1309.CurrentX = 0;
-    SSD1309.CurrentY = 0;
-    SSD1309.Rotation = ROTATION_0;
+    dev->CurrentX = 0;
+    dev->CurrentY = 0;
+    dev->Rotation = ROTATION_0;
     
-    SSD1309.Initialized = 1; 
+    dev->Initialized = 1; 
+
+    return SSD1309_OK;
 }
 
 
-/* Fill the whole screen with the given color */
-void ssd1309_Fill(SSD1309_COLOR color) 
+/* Bits of a screenbuffer byte to set, clear and invert in a color: kernels apply */
+/* it to whole bytes under a mask, without a branch per pixel                     */
+typedef struct
 {
-    /* Set memory */
-    uint32_t i;
+    uint8_t Set;
+    uint8_t Clear;
+    uint8_t Toggle;
+} SSD1309_INK;
 
-    for(i = 0; i < sizeof(SSD1309_Buffer); i++) 
+
+/* Byte masks of color */
+static inline SSD1309_INK ssd1309_Ink(SSD1309_COLOR color)
+{
+    SSD1309_INK ink = {0x00, 0x00, 0x00};
+
+    if (color == White)
+    {
+        ink.Set = 0xFF;
+    }
+    else if (color == Inverse)
+    {
+        ink.Toggle = 0xFF;
+    }
+    else
     {
-        SSD1309_Buffer[i] = (color == Black) ? 0x00 : 0xFF;
+        ink.Clear = 0xFF;
     }
+
+    return ink;
 }
 
-/* Write the screenbuffer with changed to the screen */
-void ssd1309_UpdateScreen(void) 
+
+/* value with the bits of mask drawn in ink */
+static inline uint8_t ssd1309_ApplyInk(uint8_t value, uint8_t mask, SSD1309_INK ink)
 {
-    /* Write data to each page of RAM. Number of pages
-     * depends on the screen height:
-     *
-     *  * 32px   ==  4 pages
-     *  * 64px   ==  8 pages
-     *  * 128px  ==  16 pages 
-     */
-    for (uint8_t i = 0; i < (SSD1309_HEIGHT / 8); i++) 
+    return ((value | (mask & ink.Set)) & ~(mask & ink.Clear)) ^ (mask & ink.Toggle);
+}
+
+
+/* Fill the clipped box x1..x2, y1..y2 (ordered, inside the buffer) a page at a time: */
+/* pages it covers fully are memset, the partial top and bottom pages are masked      */
+static void ssd1309_FillBox(SSD1309_t *dev, uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1309_COLOR color)
+{
+    uint8_t page1   = y1 / 8;
+    uint8_t page2   = y2 / 8;
+    uint8_t width   = x2 - x1 + 1;
+    SSD1309_INK ink = ssd1309_Ink(color);
+
+    ssd1309_MarkDirty(dev, x1, x2, page1, page2);
+    SSD1309_STATS_ADD(dev, Pixels, (uint32_t)width * (y2 - y1 + 1));
+
+    for (uint8_t page = page1; page <= page2; page++)
     {
-        ssd1309_WriteCommand(0xB0 + i);
-        ssd1309_WriteCommand(0x00 + SSD1309_X_OFFSET_LOWER);
-        ssd1309_WriteCommand(0x10 + SSD1309_X_OFFSET_UPPER);
-        ssd1309_WriteData(&SSD1309_Buffer[SSD1309_WIDTH * i], SSD1309_WIDTH);
+        uint8_t *row = &dev->Buffer[dev->Width * page + x1];
+        uint8_t mask = 0xFF;
+
+        if (page == page1)
+        {
+            mask &= 0xFF << (y1 % 8);
+        }
+
+        if (page == page2)
+        {
+            mask &= 0xFF >> (7 - (y2 % 8));
+        }
+
+        SSD1309_TRACE_BYTES(dev, dev->Width * page + x1, width);
+
+        if ((mask == 0xFF) && (color != Inverse))
+        {
+            memset(row, ink.Set, width);
+        }
+        else
+        {
+            for (uint8_t i = 0; i < width; i++)
+            {
+                row[i] = ssd1309_ApplyInk(row[i], mask, ink);
+            }
+        }
     }
 }
 
-/*    Draw one pixel in the screenbuffer  */
-/*    X => X Coordinate			  */
-/*    Y => Y Coordinate			  */
-/*    color => Pixel color		  */
-void ssd1309_DrawPixel(uint8_t x, uint8_t y, SSD1309_COLOR color) 
+
+/* Fill the clipped box x1..x2, y1..y2 (ordered) of the rotated screen, a box of the */
+/* screenbuffer either way: rows of a portrait screen are filled as column runs      */
+static void ssd1309_FillArea(SSD1309_t *dev, uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1309_COLOR color)
 {
-    if ((x >= SSD1309_WIDTH) || (y >= SSD1309_HEIGHT)) 
+    if (SSD1309_PORTRAIT(dev))
     {
-        /* Don't write outside the buffer */
-        return;
+        ssd1309_FillBox(dev, SSD1309_PORTRAIT_COLUMN(dev, y2), x1, SSD1309_PORTRAIT_COLUMN(dev, y1), x2, color);
     }
-    
-    /* Draw in the right color */
-    if (color == White) 
+    else
     {
-	    SSD1309_Buffer[x + (y / 8) * SSD1309_WIDTH] |= 1 << (y % 8);
-    } 
-    else 
-    { 
-	    SSD1309_Buffer[x + (y / 8) * SSD1309_WIDTH] &= ~(1 << (y % 8));
+        ssd1309_FillBox(dev, x1, y1, x2, y2, color);
     }
 }
 
-/* Draw 1 char to the screen buffer	      */
-/* ch         => char om weg te schrijven     */
-/* Font     => Font waarmee we gaan schrijven */
-/* color     => Black or White                */
-char ssd1309_WriteChar(char ch, FontDef Font, SSD1309_COLOR color) 
-{
-    uint32_t i, b, j;
 
-    /* Check if character is valid */
-    if (ch < 32 || ch > 126)
+/* Intersect the ordered box x1..x2, y1..y2 of the rotated screen with the clip, */
+/* false when nothing of it is left                                              */
+static inline bool ssd1309_ClipBox(const SSD1309_t *dev, int16_t *x1, int16_t *y1, int16_t *x2, int16_t *y2)
+{
+    if (*x1 < dev->Clip.x1)
     {
-        return 0;
+        *x1 = dev->Clip.x1;
     }
-    
-    /* Check remaining space on current line */
-    if ((SSD1309_WIDTH <= (SSD1309.CurrentX + Font.FontWidth))  ||
-        (SSD1309_HEIGHT <= (SSD1309.CurrentY + Font.FontHeight))
-       )
+
+    if (*y1 < dev->Clip.y1)
     {
-        /* Not enough space on current line */
-        return 0;
+        *y1 = dev->Clip.y1;
     }
-    
-    /* Use the font to write */
-    for (i = 0; i < Font.FontHeight; i++) 
+
+    if (*x2 > dev->Clip.x2)
     {
-	b = Font.data[(ch - 32) * Font.FontHeight + i];
+        *x2 = dev->Clip.x2;
+    }
 
-        for (j = 0; j < Font.FontWidth; j++) 
-	{
-            if ((b << j) & 0x8000)  
-	    {
-                ssd1309_DrawPixel(SSD1309.CurrentX + j, (SSD1309.CurrentY + i), (SSD1309_COLOR)color);
-            } 
-	    else 
-	    {
-                ssd1309_DrawPixel(SSD1309.CurrentX + j, (SSD1309.CurrentY + i), (SSD1309_COLOR)!color);
-            }
-        }
+    if (*y2 > dev->Clip.y2)
+    {
+        *y2 = dev->Clip.y2;
     }
-    
-    /* The current space is now taken */
-    SSD1309.CurrentX += Font.FontWidth;
-    
-    /* Return written char for validation */
-    return ch;
+
+    return (*x1 <= *x2) && (*y1 <= *y2);
 }
 
 
-void ssd1309_WriteSymbol(SymbolID_t Symbol, uint8_t x, uint8_t y)
+/* Test the ordered box x1..x2, y1..y2 against the clip: false when it lies outside, */
+/* otherwise *inside tells whether its points can be drawn unchecked                 */
+static inline bool ssd1309_ClipTest(const SSD1309_t *dev, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                                    bool *inside)
 {
-    uint32_t i, b, j;
-    SSD1309_COLOR color = White;
-
-    ssd1309_SetCursor(x, y);
-    
-    /* Check remaining space on current line */
-    if ((SSD1309_WIDTH <= (SSD1309.CurrentX + SSD1309_Symbol[Symbol].SymbolWidth))  ||
-        (SSD1309_HEIGHT <= (SSD1309.CurrentY + SSD1309_Symbol[Symbol].SymbolHeight))
-       )
+    if ((x2 < dev->Clip.x1) || (x1 > dev->Clip.x2) || (y2 < dev->Clip.y1) || (y1 > dev->Clip.y2))
     {
-        /* Not enough space on current line */
-        return ;
+        return false;
     }
 
-    /* Use the data to write */
-    for (i = 0; i <= SSD1309_Symbol[Symbol].SymbolHeight; i++) 
-    {
-	b = SSD1309_Symbol[Symbol].data[i];
+    *inside = (x1 >= dev->Clip.x1) && (x2 <= dev->Clip.x2) && (y1 >= dev->Clip.y1) && (y2 <= dev->Clip.y2);
 
-        for (j = 0; j < SSD1309_Symbol[Symbol].SymbolWidth; j++) 
-	{
-            if ((b << j) & 0x8000)  
-	    {
-                ssd1309_DrawPixel(SSD1309.CurrentX + j, (SSD1309.CurrentY + i), (SSD1309_COLOR)color);
-            } 
-	    else 
-	    {
-                ssd1309_DrawPixel(SSD1309.CurrentX + j, (SSD1309.CurrentY + i), (SSD1309_COLOR)!color);
-            }
-        }
+    return true;
+}
+
+
+/* Fill the ordered box x1..x2, y1..y2 of the rotated screen, clipped */
+static void ssd1309_FillClipped(SSD1309_t *dev, int16_t x1, int16_t y1, int16_t x2, int16_t y2, SSD1309_COLOR color)
+{
+    if (ssd1309_ClipBox(dev, &x1, &y1, &x2, &y2))
+    {
+        ssd1309_FillArea(dev, x1, y1, x2, y2, color);
     }
-    
-    /* The current space is now taken */
-    SSD1309.CurrentX += SSD1309_Symbol[Symbol].SymbolWidth;
 }
 
 
-/* Write full string to screenbuffer */
-char ssd1309_WriteString(char* str, FontDef Font, SSD1309_COLOR color) 
+/* Fill the clip with the given color, the whole screen unless one is pushed */
+void ssd1309_Fill(SSD1309_t *dev, SSD1309_COLOR color) 
 {
-    char data[64];
-    uint8_t data_counter = 0;
-    uint8_t print_counter;
+    ssd1309_FillClipped(dev, dev->Clip.x1, dev->Clip.y1, dev->Clip.x2, dev->Clip.y2, color);
+}
 
-    CLEAR_BUFFER(data);
+/* Append a transfer to the queued update, split in pieces the transport takes at once */
+static void ssd1309_QueueTransfer(SSD1309_t *dev, uint8_t type, uint8_t *data, uint16_t size)
+{
+    uint16_t chunk;
 
-    /* Write until null-byte */
-    while (*str) 
+    while (size > 0)
     {
-        if (ssd1309_WriteChar(*str, Font, color) != *str) 
+        chunk = (size > SSD1309_MAX_TRANSFER_SIZE) ? SSD1309_MAX_TRANSFER_SIZE : size;
+
+        dev->Transfers[dev->TransferCount].Type = type;
+        dev->Transfers[dev->TransferCount].Data = data;
+        dev->Transfers[dev->TransferCount].Size = chunk;
+        dev->TransferCount++;
+
+        if (NULL != data)
         {
-            /* Char could not be written */
-            return *str;
+            data += chunk;
         }
-    
-        /* Next char */
-        str++;
+        size -= chunk;
     }
-    
-    /* Everything ok */
-    return *str;
 }
 
 
-/* Position the cursor */
-void ssd1309_SetCursor(uint8_t x, uint8_t y) 
+/* Append a command byte to the queued update, joining the previous command transfer */
+static void ssd1309_QueueCommand(SSD1309_t *dev, uint8_t byte)
+{
+    uint8_t *command = &dev->TransferCommands[SSD1309_HEADROOM + dev->CommandCount];
+
+    *command = byte;
+
+    if ((dev->TransferCount > 0) &&
+        (dev->Transfers[dev->TransferCount - 1].Type == OLED_WRITE_COMMAND) &&
+        (dev->Transfers[dev->TransferCount - 1].Size < SSD1309_MAX_TRANSFER_SIZE))
+    {
+        dev->Transfers[dev->TransferCount - 1].Size++;
+    }
+    else
+    {
+        ssd1309_QueueTransfer(dev, OLED_WRITE_COMMAND, command, 1);
+    }
+
+    dev->CommandCount++;
+}
+
+
+/* Switch the controller to another memory addressing mode */
+static void ssd1309_SetAddressing(SSD1309_t *dev, SSD1309_ADDRESSING mode)
+{
+    if (dev->Addressing != mode)
+    {
+        ssd1309_QueueCommand(dev, 0x20);
+        ssd1309_QueueCommand(dev, mode);
+        dev->Addressing = mode;
+    }
+}
+
+
+/* Cost of switching to the given addressing mode, it joins the next command transaction */
+static uint32_t ssd1309_AddressingCost(SSD1309_t *dev, SSD1309_ADDRESSING mode)
+{
+    return (dev->Addressing != mode) ? 2 : 0;
+}
+
+
+/* Shrink the dirty span of a page to the bytes that differ from the shadow */
+static void ssd1309_DiffShadow(SSD1309_t *dev, const uint8_t *buffer, uint8_t page)
+{
+    const uint8_t *row = &buffer[dev->Width * page];
+    const uint8_t *shadow = &dev->Shadow[dev->Width * page];
+    uint8_t min = dev->DirtyMin[page];
+    uint8_t max = dev->DirtyMax[page];
+
+    while ((min <= max) && (row[min] == shadow[min]))
+    {
+        min++;
+    }
+
+    while ((max > min) && (row[max] == shadow[max]))
+    {
+        max--;
+    }
+
+    if (min > max)
+    {
+        /* Redrawn with the same content */
+        dev->DirtyMin[page] = 0xFF;
+        dev->DirtyMax[page] = 0x00;
+    }
+    else
+    {
+        dev->DirtyMin[page] = min;
+        dev->DirtyMax[page] = max;
+    }
+}
+
+
+/* Find the run of a page to send from column x on. Without a shadow the
+ * dirty span is one run; with it, unchanged gaps cheaper to resend than a
+ * new column address are merged and the last allowed run takes the rest. */
+static bool ssd1309_NextRun(SSD1309_t *dev, const uint8_t *buffer, uint8_t page, uint16_t x, uint8_t runs,
+                            uint8_t *start, uint8_t *end)
+{
+    const uint8_t *row = &buffer[dev->Width * page];
+    const uint8_t *shadow = &dev->Shadow[dev->Width * page];
+    uint8_t max = dev->DirtyMax[page];
+    uint8_t gap = 0;
+
+    if ((x > max) || (dev->DirtyMin[page] > max))
+    {
+        return false;
+    }
+
+    if ((NULL == dev->Shadow) || !dev->ShadowValid)
+    {
+        *start = x;
+        *end   = max;
+        return true;
+    }
+
+    /* The span ends on a changed byte, so one is found */
+    while (row[x] == shadow[x])
+    {
+        x++;
+    }
+
+    *start = x;
+    *end   = (runs + 1 >= SSD1309_MAX_RUNS) ? max : x;
+
+    while ((x < max) && (gap < SSD1309_RUN_COST))
+    {
+        x++;
+
+        if (row[x] != shadow[x])
+        {
+            *end = x;
+            gap  = 0;
+        }
+        else
+        {
+            gap++;
+        }
+    }
+
+    return true;
+}
+
+
+/* Clip the dirty spans to the controller RAM and compute their bounding box */
+static bool ssd1309_GetDirtyRegion(SSD1309_t *dev, const uint8_t *buffer, SSD1309_REGION *region)
+{
+    uint8_t start;
+    uint8_t end;
+    uint8_t runs;
+
+    region->PageStart = 0xFF;
+    region->PageEnd   = 0;
+    region->XStart    = 0xFF;
+    region->XEnd      = 0;
+    region->Pages     = 0;
+    region->Runs      = 0;
+    region->Bytes     = 0;
+
+    for (uint8_t i = 0; i < dev->Pages; i++)
+    {
+        /* Columns outside the controller RAM are never shown */
+        if (dev->DirtyMin[i] < SSD1309_VISIBLE_X_MIN(dev))
+        {
+            dev->DirtyMin[i] = SSD1309_VISIBLE_X_MIN(dev);
+        }
+
+        if (dev->DirtyMax[i] > SSD1309_VISIBLE_X_MAX(dev))
+        {
+            dev->DirtyMax[i] = SSD1309_VISIBLE_X_MAX(dev);
+        }
+
+        if ((NULL != dev->Shadow) && dev->ShadowValid)
+        {
+            ssd1309_DiffShadow(dev, buffer, i);
+        }
+
+        if (dev->DirtyMin[i] > dev->DirtyMax[i])
+        {
+            continue;
+        }
+
+        if (region->PageStart == 0xFF)
+        {
+            region->PageStart = i;
+        }
+        region->PageEnd = i;
+
+        if (dev->DirtyMin[i] < region->XStart)
+        {
+            region->XStart = dev->DirtyMin[i];
+        }
+
+        if (dev->DirtyMax[i] > region->XEnd)
+        {
+            region->XEnd = dev->DirtyMax[i];
+        }
+
+        region->Pages++;
+
+        for (runs = 0; ssd1309_NextRun(dev, buffer, i, (runs == 0) ? dev->DirtyMin[i] : end + 1, runs, &start, &end); runs++)
+        {
+            region->Bytes += end - start + 1;
+        }
+        region->Runs += runs;
+    }
+
+    return (region->Pages > 0);
+}
+
+
+/* Data transactions of the region through a horizontal window. Whole rows of the */
+/* screenbuffer follow each other and go in one burst; otherwise the columns left  */
+/* out, like those off the panel, lie between the rows, which are then sent one by */
+/* one or gathered back to back through the scratch buffer when that takes fewer    */
+static uint32_t ssd1309_WindowRows(SSD1309_t *dev, const SSD1309_REGION *region, bool *gather)
+{
+    uint32_t box_pages = region->PageEnd - region->PageStart + 1;
+    uint32_t box_bytes = (region->XEnd - region->XStart + 1) * box_pages;
+
+    *gather = false;
+
+    if ((region->XStart == 0) && (region->XEnd == (dev->Width - 1)))
+    {
+        return 1;
+    }
+
+    if (SSD1309_GATHER_CHUNKS(box_bytes) < box_pages)
+    {
+        *gather = true;
+        return SSD1309_GATHER_CHUNKS(box_bytes);
+    }
+
+    return box_pages;
+}
+
+
+/* Pick the cheapest addressing mode for the region */
+static SSD1309_ADDRESSING ssd1309_ChooseAddressing(SSD1309_t *dev, const SSD1309_REGION *region)
+{
+    uint32_t box_pages = region->PageEnd - region->PageStart + 1;
+    uint32_t box_bytes = (region->XEnd - region->XStart + 1) * box_pages;
+    bool gather;
+    uint32_t box_rows  = ssd1309_WindowRows(dev, region, &gather);
+    uint32_t page_cost;
+    uint32_t horizontal_cost;
+    uint32_t vertical_cost;
+
+    if (dev->FlushMode != SSD1309_ADDRESSING_AUTO)
+    {
+        return dev->FlushMode;
+    }
+
+    /* Page: page and column commands in front of the first run of a page, */
+    /* column commands only in front of the next ones                      */
+    page_cost = ssd1309_AddressingCost(dev, SSD1309_ADDRESSING_PAGE) +
+                (region->Runs * SSD1309_COMMAND_COST(2)) + region->Pages +
+                SSD1309_DATA_COST(region->Bytes, region->Runs);
+
+    /* Horizontal: one window, the box rows are streamed from the screenbuffer or gathered */
+    horizontal_cost = ssd1309_AddressingCost(dev, SSD1309_ADDRESSING_HORIZONTAL) +
+                      SSD1309_COMMAND_COST(6) +
+                      SSD1309_DATA_COST(box_bytes, box_rows);
+
+    /* Vertical: one window, the box is reordered column by column through the scratch buffer */
+    vertical_cost = ssd1309_AddressingCost(dev, SSD1309_ADDRESSING_VERTICAL) +
+                    SSD1309_COMMAND_COST(6) +
+                    SSD1309_DATA_COST(box_bytes, SSD1309_GATHER_CHUNKS(box_bytes));
+
+    if ((page_cost <= horizontal_cost) && (page_cost <= vertical_cost))
+    {
+        return SSD1309_ADDRESSING_PAGE;
+    }
+
+    return (horizontal_cost <= vertical_cost) ? SSD1309_ADDRESSING_HORIZONTAL : SSD1309_ADDRESSING_VERTICAL;
+}
+
+
+/* Queue every run of every dirty page with its own column address */
+static void ssd1309_QueuePages(SSD1309_t *dev, uint8_t *buffer, const SSD1309_REGION *region)
+{
+    uint8_t column;
+    uint8_t start;
+    uint8_t end;
+    uint8_t runs;
+
+    ssd1309_SetAddressing(dev, SSD1309_ADDRESSING_PAGE);
+
+    for (uint8_t i = region->PageStart; i <= region->PageEnd; i++)
+    {
+        for (runs = 0; ssd1309_NextRun(dev, buffer, i, (runs == 0) ? dev->DirtyMin[i] : end + 1, runs, &start, &end); runs++)
+        {
+            column = start + dev->OffsetX;
+
+            if (runs == 0)
+            {
+                ssd1309_QueueCommand(dev, 0xB0 + i);
+            }
+            ssd1309_QueueCommand(dev, 0x00 | (column & 0x0F));
+            ssd1309_QueueCommand(dev, 0x10 | ((column >> 4) & 0x07));
+            ssd1309_QueueTransfer(dev, OLED_WRITE_DATA, &buffer[dev->Width * i + start], end - start + 1);
+        }
+    }
+}
+
+
+/* Queue the bounding box of the dirty spans through a 0x21/0x22 window */
+static void ssd1309_QueueWindow(SSD1309_t *dev, uint8_t *buffer, const SSD1309_REGION *region, SSD1309_ADDRESSING mode)
+{
+    uint8_t width = region->XEnd - region->XStart + 1;
+    uint32_t remaining;
+    bool gather   = true;
+
+    ssd1309_SetAddressing(dev, mode);
+
+    ssd1309_QueueCommand(dev, 0x21); /* Set column address */
+    ssd1309_QueueCommand(dev, region->XStart + dev->OffsetX);
+    ssd1309_QueueCommand(dev, region->XEnd + dev->OffsetX);
+    ssd1309_QueueCommand(dev, 0x22); /* Set page address */
+    ssd1309_QueueCommand(dev, region->PageStart);
+    ssd1309_QueueCommand(dev, region->PageEnd);
+
+    if (mode == SSD1309_ADDRESSING_HORIZONTAL)
+    {
+        (void)ssd1309_WindowRows(dev, region, &gather);
+    }
+    else
+    {
+        /* Nothing to do */
+    }
+
+    if (!gather && (width == dev->Width))
+    {
+        /* Whole rows are contiguous in the screenbuffer: a single burst */
+        ssd1309_QueueTransfer(dev, OLED_WRITE_DATA, &buffer[dev->Width * region->PageStart],
+                              dev->Width * (region->PageEnd - region->PageStart + 1));
+    }
+    else if (!gather)
+    {
+        for (uint8_t i = region->PageStart; i <= region->PageEnd; i++)
+        {
+            ssd1309_QueueTransfer(dev, OLED_WRITE_DATA, &buffer[dev->Width * i + region->XStart], width);
+        }
+    }
+    else
+    {
+        /* Chunks are copied into the scratch buffer in window order right before they are sent */
+        dev->GatherBuffer = buffer;
+        dev->GatherMode   = mode;
+        dev->GatherRegion = *region;
+        dev->GatherX      = region->XStart;
+        dev->GatherPage   = region->PageStart;
+
+        remaining = width * (region->PageEnd - region->PageStart + 1);
+        while (remaining > 0)
+        {
+            uint16_t size = (remaining > SSD1309_STREAM_CHUNK_SIZE) ? SSD1309_STREAM_CHUNK_SIZE : remaining;
+
+            ssd1309_QueueTransfer(dev, OLED_WRITE_DATA, NULL, size);
+            remaining -= size;
+        }
+    }
+}
+
+
+/* Current time from the timestamp handle */
+static uint32_t ssd1309_Timestamp(SSD1309_t *dev)
+{
+    return (NULL != dev->TimestampHandle) ? dev->TimestampHandle() : 0;
+}
+
+
+/* Queue the transfers that bring the panel up to date with the buffer */
+static bool ssd1309_QueueUpdate(SSD1309_t *dev, uint8_t *buffer)
+{
+    SSD1309_REGION region;
+    SSD1309_ADDRESSING mode;
+    bool queued = false;
+
+    dev->TransferCount = 0;
+    dev->CommandCount  = 0;
+
+    dev->Throughput.Bytes        = 0;
+    dev->Throughput.Transactions = 0;
+    dev->Throughput.Ticks        = 0;
+    dev->UpdateStart             = ssd1309_Timestamp(dev);
+
+    /* Only the dirty columns of each page of RAM are sent. Number
+     * of pages depends on the screen height:
+     *
+     *  * 32px   ==  4 pages
+     *  * 64px   ==  8 pages
+     *  * 128px  ==  16 pages 
+     */
+    if (ssd1309_GetDirtyRegion(dev, buffer, &region))
+    {
+        mode = ssd1309_ChooseAddressing(dev, &region);
+
+        if (mode == SSD1309_ADDRESSING_PAGE)
+        {
+            ssd1309_QueuePages(dev, buffer, &region);
+        }
+        else
+        {
+            ssd1309_QueueWindow(dev, buffer, &region, mode);
+        }
+
+        queued = true;
+    }
+
+    if (dev->StartLinePending)
+    {
+        ssd1309_QueueCommand(dev, 0x40 | dev->StartLine);
+        dev->StartLinePending = false;
+        queued = true;
+    }
+
+    if (queued)
+    {
+        SSD1309_STATS_ADD(dev, Flushes, 1);
+    }
+    else
+    {
+        SSD1309_STATS_ADD(dev, SkippedFlushes, 1);
+    }
+
+    if (NULL != dev->Shadow)
+    {
+        /* The display RAM now holds the dirty spans, gaps between runs included */
+        for (uint8_t i = 0; i < dev->Pages; i++)
+        {
+            if (dev->DirtyMin[i] <= dev->DirtyMax[i])
+            {
+                memcpy(&dev->Shadow[dev->Width * i + dev->DirtyMin[i]],
+                       &buffer[dev->Width * i + dev->DirtyMin[i]],
+                       dev->DirtyMax[i] - dev->DirtyMin[i] + 1);
+            }
+        }
+
+        dev->ShadowValid = true;
+    }
+
+    /* Every page is clean again */
+    memset(dev->DirtyMin, 0xFF, sizeof(dev->DirtyMin));
+    memset(dev->DirtyMax, 0x00, sizeof(dev->DirtyMax));
+
+    return queued;
+}
+
+
+/* Time of the update that just left the bus */
+static void ssd1309_UpdateDone(SSD1309_t *dev)
+{
+    dev->Throughput.Ticks = ssd1309_Timestamp(dev) - dev->UpdateStart;
+
+#if defined(SSD1309_ENABLE_STATS)
+    if ((NULL != dev->TimestampHandle) && (dev->TransferCount > 0))
+    {
+        uint8_t bucket = 0;
+
+        /* Bucket n holds durations of 2^(n-1) to 2^n - 1 ticks */
+        while (((dev->Throughput.Ticks >> bucket) != 0) && (bucket < (SSD1309_STATS_BUCKETS - 1)))
+        {
+            bucket++;
+        }
+
+        dev->Stats.Duration[bucket]++;
+    }
+#endif
+}
+
+
+/* Hand one queued transfer to the transport */
+static void ssd1309_StartTransfer(SSD1309_t *dev, const SSD1309_TRANSFER *transfer, bool async)
+{
+    uint8_t *data = transfer->Data;
+
+    if (NULL == data)
+    {
+        data = &dev->FlushScratch[SSD1309_HEADROOM];
+
+        for (uint16_t i = 0; i < transfer->Size; i++)
+        {
+            data[i] = dev->GatherBuffer[dev->Width * dev->GatherPage + dev->GatherX];
+
+            if (dev->GatherMode == SSD1309_ADDRESSING_HORIZONTAL)
+            {
+                /* Row by row, the visible columns of each page back to back */
+                if (dev->GatherX == dev->GatherRegion.XEnd)
+                {
+                    dev->GatherX = dev->GatherRegion.XStart;
+                    dev->GatherPage++;
+                }
+                else
+                {
+                    dev->GatherX++;
+                }
+            }
+            else if (dev->GatherPage == dev->GatherRegion.PageEnd)
+            {
+                dev->GatherPage = dev->GatherRegion.PageStart;
+                dev->GatherX++;
+            }
+            else
+            {
+                dev->GatherPage++;
+            }
+        }
+    }
+
+    dev->Throughput.Bytes += SSD1309_HEADROOM + transfer->Size;
+    dev->Throughput.Transactions++;
+
+    ssd1309_Transmit(dev, transfer->Type, data, transfer->Size, async);
+}
+
+
+/* Send the queued update without waiting for completion events */
+static void ssd1309_RunTransfers(SSD1309_t *dev)
+{
+    for (uint16_t i = 0; i < dev->TransferCount; i++)
+    {
+        ssd1309_StartTransfer(dev, &dev->Transfers[i], false);
+        ssd1309_TransmitDone(dev);
+    }
+
+    ssd1309_UpdateDone(dev);
+}
+
+
+/* Copy the dirty spans of every page from one screenbuffer to the other */
+static void ssd1309_CopyDirty(SSD1309_t *dev, uint8_t *dst, const uint8_t *src)
+{
+    for (uint8_t i = 0; i < dev->Pages; i++)
+    {
+        if (dev->DirtyMin[i] <= dev->DirtyMax[i])
+        {
+            memcpy(&dst[dev->Width * i + dev->DirtyMin[i]],
+                   &src[dev->Width * i + dev->DirtyMin[i]],
+                   dev->DirtyMax[i] - dev->DirtyMin[i] + 1);
+        }
+    }
+}
+
+
+/* Write the screenbuffer with changed to the screen */
+void ssd1309_UpdateScreen(SSD1309_t *dev) 
+{
+    if (dev->Busy || dev->Scrolling)
+    {
+        /* The changes stay dirty and go out with the next update */
+        return;
+    }
+
+    if (NULL != dev->FrontBuffer)
+    {
+        ssd1309_CopyDirty(dev, dev->FrontBuffer, dev->Buffer);
+    }
+
+    if (ssd1309_QueueUpdate(dev, dev->Buffer))
+    {
+        ssd1309_RunTransfers(dev);
+    }
+}
+
+
+/* Start sending the changes and return without waiting for the bus */
+SSD1309_Error_t ssd1309_UpdateScreenAsync(SSD1309_t *dev, ssd1309_done_handle done_handle)
+{
+    uint8_t *buffer = dev->Buffer;
+
+    if (dev->Busy || dev->Scrolling)
+    {
+        return SSD1309_BUSY;
+    }
+
+    if (NULL != dev->FrontBuffer)
+    {
+        /* Send the frame just drawn and keep drawing on a copy of it */
+        dev->Buffer      = dev->FrontBuffer;
+        dev->FrontBuffer = buffer;
+        ssd1309_CopyDirty(dev, dev->Buffer, dev->FrontBuffer);
+    }
+
+    if (!ssd1309_QueueUpdate(dev, buffer) || (NULL == dev->AsyncHandle))
+    {
+        ssd1309_RunTransfers(dev);
+
+        if (NULL != done_handle)
+        {
+            done_handle();
+        }
+
+        return SSD1309_OK;
+    }
+
+    dev->DoneHandle    = done_handle;
+    dev->TransferIndex = 0;
+    dev->Busy          = true;
+
+    ssd1309_StartTransfer(dev, &dev->Transfers[0], true);
+
+    return SSD1309_OK;
+}
+
+
+/* Completion of the transfer started by the async handle */
+void ssd1309_TransferDone(SSD1309_t *dev)
+{
+    if (!dev->Busy)
+    {
+        return;
+    }
+
+    ssd1309_TransmitDone(dev);
+    dev->TransferIndex++;
+
+    if (dev->TransferIndex < dev->TransferCount)
+    {
+        ssd1309_StartTransfer(dev, &dev->Transfers[dev->TransferIndex], true);
+    }
+    else
+    {
+        ssd1309_UpdateDone(dev);
+        dev->Busy = false;
+
+        if (NULL != dev->DoneHandle)
+        {
+            dev->DoneHandle();
+        }
+    }
+}
+
+
+/* Register the clock used to time updates */
+void ssd1309_SetTimestampHandle(SSD1309_t *dev, ssd1309_timestamp_handle timestamp_handle)
+{
+    dev->TimestampHandle = timestamp_handle;
+}
+
+
+/* Bus usage of the last update */
+void ssd1309_GetThroughput(SSD1309_t *dev, SSD1309_Throughput_t *throughput)
+{
+    if (NULL != throughput)
+    {
+        *throughput = dev->Throughput;
+    }
+}
+
+
+#if defined(SSD1309_ENABLE_STATS)
+/* Counters since init or the last reset */
+void ssd1309_GetStats(SSD1309_t *dev, SSD1309_Stats_t *stats)
+{
+    if (NULL != stats)
+    {
+        *stats = dev->Stats;
+    }
+}
+
+
+/* Clear the counters */
+void ssd1309_ResetStats(SSD1309_t *dev)
+{
+    memset(&dev->Stats, 0, sizeof(dev->Stats));
+}
+#endif
+
+
+/* Whether an asynchronous update is still on the bus */
+bool ssd1309_IsBusy(SSD1309_t *dev)
+{
+    return dev->Busy;
+}
+
+
+/* Select the addressing mode used by ssd1309_UpdateScreen */
+void ssd1309_SetFlushMode(SSD1309_t *dev, SSD1309_ADDRESSING mode)
+{
+    dev->FlushMode = mode;
+}
+
+
+/* Start the hardware scrolling of pages start_page..end_page */
+SSD1309_Error_t ssd1309_StartScroll(SSD1309_t *dev, SSD1309_SCROLL direction, uint8_t start_page, uint8_t end_page,
+                                    SSD1309_SCROLL_INTERVAL interval, uint8_t vertical_offset)
+{
+    uint8_t commands[13];
+    uint8_t count = 0;
+    bool vertical = (direction >= SSD1309_SCROLL_VERTICAL_RIGHT);
+    uint8_t rows  = (dev->Height > SSD1309_MAX_MUX) ? SSD1309_MAX_MUX : dev->Height;
+
+    if (dev->Busy)
+    {
+        return SSD1309_BUSY;
+    }
+
+    /* The panel scrolls its pages, which run across the screen when turned to portrait */
+    if (SSD1309_PORTRAIT(dev) || (start_page > end_page) || (end_page >= dev->Pages) || (end_page > 7) ||
+        (vertical && ((vertical_offset == 0) || (vertical_offset >= rows))))
+    {
+        return SSD1309_ERR;
+    }
+
+    /* Put the band of a running scroll back first, StopScroll only restores the last one */
+    if (dev->Scrolling)
+    {
+        ssd1309_StopScroll(dev);
+    }
+    else
+    {
+        /* Nothing to do */
+    }
+
+    commands[count++] = 0x2E;   /* Deactivate scroll before setting it up */
+
+    if (vertical)
+    {
+        commands[count++] = 0xA3;   /* Set vertical scroll area: the whole screen, at most the multiplex ratio */
+        commands[count++] = 0x00;
+        commands[count++] = rows;
+
+        commands[count++] = (direction == SSD1309_SCROLL_VERTICAL_LEFT) ? 0x2A : 0x29;
+        commands[count++] = (direction == SSD1309_SCROLL_VERTICAL) ? 0x00 : 0x01;
+    }
+    else
+    {
+        commands[count++] = (direction == SSD1309_SCROLL_LEFT) ? 0x27 : 0x26;
+        commands[count++] = 0x00;   /* Dummy byte */
+    }
+
+    commands[count++] = start_page;
+    commands[count++] = interval;
+    commands[count++] = end_page;
+
+    if (vertical)
+    {
+        commands[count++] = vertical_offset;
+    }
+
+    commands[count++] = SSD1309_VISIBLE_X_MIN(dev) + dev->OffsetX;
+    commands[count++] = SSD1309_VISIBLE_X_MAX(dev) + dev->OffsetX;
+    commands[count++] = 0x2F;   /* Activate scroll */
+
+    ssd1309_WriteCommands(dev, commands, count);
+
+    dev->Scrolling       = true;
+    dev->ScrollStartPage = start_page;
+    dev->ScrollEndPage   = end_page;
+
+    return SSD1309_OK;
+}
+
+
+/* Stop the hardware scrolling and put the screenbuffer back on the panel */
+void ssd1309_StopScroll(SSD1309_t *dev)
+{
+    if (!dev->Scrolling)
+    {
+        return;
+    }
+
+    ssd1309_WriteCommand(dev, 0x2E);
+    dev->Scrolling = false;
+
+    /* The scrolled pages of the display RAM are no longer known */
+    dev->ShadowValid = false;
+    ssd1309_MarkDirty(dev, 0, dev->Width - 1, dev->ScrollStartPage, dev->ScrollEndPage);
+
+    ssd1309_UpdateScreen(dev);
+}
+
+
+/* Set the display start line, sent with the next update */
+void ssd1309_SetStartLine(SSD1309_t *dev, uint8_t line)
+{
+    dev->StartLine        = line & 0x3F;
+    dev->StartLinePending = true;
+}
+
+
+/* Whether the panel is scrolling */
+bool ssd1309_IsScrolling(SSD1309_t *dev)
+{
+    return dev->Scrolling;
+}
+
+
+/* Set one pixel of the screenbuffer, x and y inside it and unrotated */
+static void ssd1309_SetPixel(SSD1309_t *dev, uint8_t x, uint8_t y, SSD1309_COLOR color)
+{
+    uint8_t *pixel = &dev->Buffer[x + (y / 8) * dev->Width];
+
+    ssd1309_MarkDirty(dev, x, x, y / 8, y / 8);
+    SSD1309_TRACE_PIXEL(dev, x, y);
+    SSD1309_STATS_ADD(dev, Pixels, 1);
+
+    /* Draw in the right color */
+    *pixel = ssd1309_ApplyInk(*pixel, 1 << (y % 8), ssd1309_Ink(color));
+}
+
+
+/* Set one pixel of the rotated screen, x and y inside it */
+static inline void ssd1309_PlotPixel(SSD1309_t *dev, int16_t x, int16_t y, SSD1309_COLOR color)
+{
+    if (SSD1309_PORTRAIT(dev))
+    {
+        ssd1309_SetPixel(dev, SSD1309_PORTRAIT_COLUMN(dev, y), x, color);
+    }
+    else
+    {
+        ssd1309_SetPixel(dev, x, y, color);
+    }
+}
+
+
+/* Set one pixel of the rotated screen, dropped outside the clip */
+static void ssd1309_DrawPixelClipped(SSD1309_t *dev, int16_t x, int16_t y, SSD1309_COLOR color)
+{
+    if ((x < dev->Clip.x1) || (x > dev->Clip.x2) || (y < dev->Clip.y1) || (y > dev->Clip.y2))
+    {
+        return;
+    }
+
+    ssd1309_PlotPixel(dev, x, y, color);
+}
+
+
+/* Set one pixel of an outline whose box was tested against the clip once */
+static inline void ssd1309_PlotPoint(SSD1309_t *dev, int16_t x, int16_t y, bool inside, SSD1309_COLOR color)
+{
+    if (inside)
+    {
+        ssd1309_PlotPixel(dev, x, y, color);
+    }
+    else
+    {
+        ssd1309_DrawPixelClipped(dev, x, y, color);
+    }
+}
+
+
+/*    Draw one pixel in the screenbuffer  */
+/*    X => X Coordinate			  */
+/*    Y => Y Coordinate			  */
+/*    color => Pixel color		  */
+void ssd1309_DrawPixel(SSD1309_t *dev, uint8_t x, uint8_t y, SSD1309_COLOR color) 
+{
+    ssd1309_DrawPixelClipped(dev, dev->OriginX + x, dev->OriginY + y, color);
+}
+
+/* Column bytes of a portrait screen, gathered for the eight columns that share a */
+/* screenbuffer row, then written transposed: a screenbuffer byte per screen row  */
+typedef struct
+{
+    uint64_t Set;       /* Rows to set, clear and invert, byte j for column X + j */
+    uint64_t Clear;
+    uint64_t Toggle;
+    int16_t X;          /* First screen column, a multiple of 8, -1 when empty     */
+    int16_t Top;        /* Screen row of bit 0                                     */
+} SSD1309_BLOCK;
+
+
+/* Transpose 8 x 8 bits: bit k of byte j becomes bit j of byte k. */
+/* Swaps of 2 x 2, then 4 x 4 blocks of bits, in 32 bit halves      */
+static inline uint64_t ssd1309_Transpose(uint64_t value)
+{
+    uint32_t low  = (uint32_t)value;
+    uint32_t high = (uint32_t)(value >> 32);
+    uint32_t t;
+
+    if (value == 0)
+    {
+        return 0;
+    }
+
+    t = (low ^ (low >> 7)) & 0x00AA00AA;
+    low ^= t ^ (t << 7);
+    t = (high ^ (high >> 7)) & 0x00AA00AA;
+    high ^= t ^ (t << 7);
+
+    t = (low ^ (low >> 14)) & 0x0000CCCC;
+    low ^= t ^ (t << 14);
+    t = (high ^ (high >> 14)) & 0x0000CCCC;
+    high ^= t ^ (t << 14);
+
+    t = ((low >> 4) ^ high) & 0x0F0F0F0F;
+    high ^= t;
+    low ^= t << 4;
+
+    return ((uint64_t)high << 32) | low;
+}
+
+
+/* Write the gathered columns of a portrait block and empty it */
+static void ssd1309_FlushBlock(SSD1309_t *dev, SSD1309_BLOCK *block)
+{
+    uint64_t set;
+    uint64_t clear;
+    uint64_t toggle;
+    uint8_t *row;
+    int16_t column;
+
+    if (block->X < 0)
+    {
+        return;
+    }
+
+    set    = ssd1309_Transpose(block->Set);
+    clear  = ssd1309_Transpose(block->Clear);
+    toggle = ssd1309_Transpose(block->Toggle);
+    row    = &dev->Buffer[dev->Width * (block->X / 8)];
+    column = SSD1309_PORTRAIT_COLUMN(dev, block->Top);
+
+    block->Set    = 0;
+    block->Clear  = 0;
+    block->Toggle = 0;
+    block->X      = -1;
+
+    /* Row top + k of the screen is the screenbuffer column left of row top + k - 1 */
+    for (uint8_t k = 0; k < 8; k++, column--, set >>= 8, clear >>= 8, toggle >>= 8)
+    {
+        if (((set | clear | toggle) & 0xFF) == 0)
+        {
+            continue;
+        }
+
+        SSD1309_TRACE_BYTES(dev, &row[column] - dev->Buffer, 1);
+
+        row[column] = ((row[column] | (uint8_t)set) & ~(uint8_t)clear) ^ (uint8_t)toggle;
+    }
+}
+
+
+/* Add column x of rows top..top + 7 of a portrait screen to the block, writing */
+/* it first when the column lies in another screenbuffer row or band            */
+static inline void ssd1309_PutBlock(SSD1309_t *dev, SSD1309_BLOCK *block, uint8_t x, int16_t top,
+                                    uint8_t set, uint8_t clear, uint8_t toggle)
+{
+    if ((block->X != (x & ~0x07)) || (block->Top != top))
+    {
+        ssd1309_FlushBlock(dev, block);
+        block->X   = x & ~0x07;
+        block->Top = top;
+    }
+
+    block->Set    |= (uint64_t)set << (8 * (x % 8));
+    block->Clear  |= (uint64_t)clear << (8 * (x % 8));
+    block->Toggle |= (uint64_t)toggle << (8 * (x % 8));
+}
+
+
+/* Rows top..top + 7 of a column byte that lie in y1..y2 */
+static inline uint8_t ssd1309_RowsMask(int16_t top, int16_t y1, int16_t y2)
+{
+    int16_t low  = y1 - top;
+    int16_t high = y2 - top;
+    uint8_t rows = 0xFF;
+
+    if ((low > 7) || (high < 0))
+    {
+        return 0;
+    }
+
+    if (low > 0)
+    {
+        rows &= 0xFF << low;
+    }
+
+    if (high < 7)
+    {
+        rows &= 0xFF >> (7 - high);
+    }
+
+    return rows;
+}
+
+
+/* Portrait BlitGlyph: the glyph columns are written as screenbuffer rows */
+static void ssd1309_BlitGlyphPortrait(SSD1309_t *dev, int16_t x, int16_t y, const uint8_t *glyph, uint8_t w,
+                                      uint8_t h, int16_t x1, int16_t y1, int16_t x2, int16_t y2, SSD1309_COLOR color)
+{
+    SSD1309_BLOCK block = {0, 0, 0, -1, 0};
+    uint8_t bands       = (h + 7) / 8;
+    uint8_t invert      = (color == Black) ? 0xFF : 0x00;
+    uint8_t opaque      = (color == Inverse) ? 0x00 : 0xFF;
+
+    for (uint8_t band = (y1 - y) / 8; (band < bands) && ((y + band * 8) <= y2); band++)
+    {
+        int16_t top  = y + band * 8;
+        uint8_t rows = ssd1309_RowsMask(top, y1, y2);
+
+        for (int16_t column = x1; column <= x2; column++)
+        {
+            uint8_t bits = glyph[band * w + column - x] ^ invert;
+
+            ssd1309_PutBlock(dev, &block, column, top, bits & rows & opaque, ~bits & rows & opaque,
+                             bits & rows & ~opaque);
+        }
+    }
+
+    ssd1309_FlushBlock(dev, &block);
+}
+
+
+/* Copy a page-major glyph of w x h pixels at x, y to its part x1..x2, y1..y2 on the */
+/* screen, background included unless Inverse: each column of a band lands as one    */
+/* byte, or as two shifted bytes across pages                                        */
+static void ssd1309_BlitGlyph(SSD1309_t *dev, int16_t x, int16_t y, const uint8_t *glyph, uint8_t w, uint8_t h,
+                              int16_t x1, int16_t y1, int16_t x2, int16_t y2, SSD1309_COLOR color)
+{
+    uint8_t bands   = (h + 7) / 8;
+    uint8_t invert  = (color == Black) ? 0xFF : 0x00;
+    uint16_t opaque = (color == Inverse) ? 0x0000 : 0xFFFF;
+    uint8_t columns = x2 - x1 + 1;
+
+    ssd1309_MarkArea(dev, x1, y1, x2, y2);
+    SSD1309_STATS_ADD(dev, Pixels, (uint32_t)columns * (y2 - y1 + 1));
+
+    if (SSD1309_PORTRAIT(dev))
+    {
+        ssd1309_BlitGlyphPortrait(dev, x, y, glyph, w, h, x1, y1, x2, y2, color);
+        return;
+    }
+
+    /* Bands above and below the clip are skipped, so are the columns beside it */
+    for (uint8_t band = (y1 - y) / 8; (band < bands) && ((y + band * 8) <= y2); band++)
+    {
+        int16_t top           = y + band * 8;
+        int16_t page          = (top >= 0) ? (top / 8) : -1;
+        uint8_t shift         = top - page * 8;
+        uint16_t mask         = (uint16_t)ssd1309_RowsMask(top, y1, y2) << shift;
+        const uint8_t *column = &glyph[band * w + (x1 - x)];
+        uint8_t *pixel;
+
+        if ((mask & 0xFF) == 0)
+        {
+            /* Only the lower of the two pages is visible */
+            pixel = &dev->Buffer[dev->Width * (page + 1) + x1];
+            mask >>= 8;
+
+            SSD1309_TRACE_BYTES(dev, pixel - dev->Buffer, columns);
+
+            for (uint8_t i = 0; i < columns; i++)
+            {
+                uint8_t bits = (((column[i] ^ invert) << shift) >> 8) & mask;
+
+                pixel[i] = (pixel[i] & ~(mask & opaque)) ^ bits;
+            }
+        }
+        else if ((mask >> 8) == 0)
+        {
+            /* The band fits in one page */
+            pixel = &dev->Buffer[dev->Width * page + x1];
+
+            SSD1309_TRACE_BYTES(dev, pixel - dev->Buffer, columns);
+
+            for (uint8_t i = 0; i < columns; i++)
+            {
+                pixel[i] = (pixel[i] & ~(mask & opaque)) ^ (((column[i] ^ invert) << shift) & mask);
+            }
+        }
+        else
+        {
+            uint8_t *high;
+
+            pixel = &dev->Buffer[dev->Width * page + x1];
+            high  = pixel + dev->Width;
+
+            SSD1309_TRACE_BYTES(dev, pixel - dev->Buffer, columns);
+            SSD1309_TRACE_BYTES(dev, high - dev->Buffer, columns);
+
+            for (uint8_t i = 0; i < columns; i++)
+            {
+                uint16_t bits = ((column[i] ^ invert) << shift) & mask;
+
+                pixel[i] = (pixel[i] & ~(mask & opaque)) ^ (uint8_t)bits;
+                high[i]  = (high[i] & ~((mask & opaque) >> 8)) ^ (bits >> 8);
+            }
+        }
+    }
+}
+
+
+/* Draw 1 char to the screen buffer	      */
+/* ch         => char om weg te schrijven     */
+/* Font     => Font waarmee we gaan schrijven */
+/* color     => Black, White or Inverse      */
+char ssd1309_WriteChar(SSD1309_t *dev, char ch, FontDef Font, SSD1309_COLOR color) 
+{
+    int32_t x = (int32_t)dev->OriginX + dev->CurrentX;
+    int32_t y = (int32_t)dev->OriginY + dev->CurrentY;
+    int16_t x1;
+    int16_t y1;
+    int16_t x2;
+    int16_t y2;
+
+    /* Check if character is valid */
+    if (ch < 32 || ch > 126)
+    {
+        return 0;
+    }
+    
+    /* Nothing more fits on the line once it leaves the clip on the right or bottom */
+    if ((x > dev->Clip.x2) || (y > dev->Clip.y2))
+    {
+        return 0;
+    }
+
+    /* The current space is taken, whatever part of it shows */
+    dev->CurrentX += Font.FontWidth;
+
+    if (((x + Font.FontWidth) <= dev->Clip.x1) || ((y + Font.FontHeight) <= dev->Clip.y1))
+    {
+        return ch;
+    }
+
+    x1 = (x < dev->Clip.x1) ? dev->Clip.x1 : x;
+    y1 = (y < dev->Clip.y1) ? dev->Clip.y1 : y;
+    x2 = ((x + Font.FontWidth - 1) > dev->Clip.x2) ? dev->Clip.x2 : (x + Font.FontWidth - 1);
+    y2 = ((y + Font.FontHeight - 1) > dev->Clip.y2) ? dev->Clip.y2 : (y + Font.FontHeight - 1);
+
+    if (NULL != Font.pages)
+    {
+        /* Whole glyph columns at once */
+        ssd1309_BlitGlyph(dev, x, y, &Font.pages[(ch - 32) * Font.FontWidth * ((Font.FontHeight + 7) / 8)],
+                          Font.FontWidth, Font.FontHeight, x1, y1, x2, y2, color);
+
+        return ch;
+    }
+
+    /* Use the font to write, the visible rows and columns only */
+    for (int16_t i = y1; i <= y2; i++)
+    {
+        uint32_t b = Font.data[(ch - 32) * Font.FontHeight + (i - y)];
+
+        for (int16_t j = x1; j <= x2; j++)
+        {
+            bool ink = ((b << (j - x)) & 0x8000) != 0;
+
+            /* Inverse leaves the background */
+            if (ink || (color != Inverse))
+            {
+                ssd1309_PlotPixel(dev, j, i, ink ? color : (SSD1309_COLOR)!color);
+            }
+        }
+    }
+    
+    /* Return written char for validation */
+    return ch;
+}
+
+
+void ssd1309_WriteSymbol(SSD1309_t *dev, SymbolID_t Symbol, uint8_t x, uint8_t y)
+{
+    const SymbolDef *symbol = &SSD1309_Symbol[Symbol];
+    SSD1309_COLOR color     = White;
+    int16_t left;
+    int16_t top;
+    int16_t x1;
+    int16_t y1;
+    int16_t x2;
+    int16_t y2;
+
+    ssd1309_SetCursor(dev, x, y);
+
+    left = dev->OriginX + dev->CurrentX;
+    top  = dev->OriginY + dev->CurrentY;
+    x1   = left;
+    y1   = top;
+    x2   = left + symbol->SymbolWidth - 1;
+    y2   = top + symbol->SymbolHeight - 1;
+
+    /* The current space is now taken */
+    dev->CurrentX += symbol->SymbolWidth;
+
+    if (!ssd1309_ClipBox(dev, &x1, &y1, &x2, &y2))
+    {
+        return;
+    }
+
+    /* Use the data to write, the visible rows and columns only */
+    for (int16_t i = y1; i <= y2; i++)
+    {
+        uint32_t b = symbol->data[i - top];
+
+        for (int16_t j = x1; j <= x2; j++)
+        {
+            ssd1309_PlotPixel(dev, j, i, ((b << (j - left)) & 0x8000) ? color : (SSD1309_COLOR)!color);
+        }
+    }
+}
+
+
+/* Run-length decoder of the glyph bitmaps, format in ssd1309_fonts.h */
+typedef struct
+{
+    const uint8_t *Data;
+    uint8_t Count;      /* Bytes left in the current run */
+    uint8_t Value;
+    bool Literal;
+} SSD1309_RLE;
+
+
+/* Next byte of a run-length coded stream */
+static uint8_t ssd1309_RleNext(SSD1309_RLE *rle)
+{
+    if (rle->Count == 0)
+    {
+        uint8_t header = *rle->Data++;
+
+        if (header < 0x80)
+        {
+            rle->Literal = true;
+            rle->Count   = header + 1;
+        }
+        else if (header < 0xC0)
+        {
+            rle->Literal = false;
+            rle->Count   = header - 0x80 + 2;
+            rle->Value   = *rle->Data++;
+        }
+        else
+        {
+            rle->Literal = false;
+            rle->Count   = header - 0xC0 + 1;
+            rle->Value   = 0x00;
+        }
+    }
+
+    rle->Count--;
+
+    return rle->Literal ? *rle->Data++ : rle->Value;
+}
+
+
+/* Draw the set bits of a column byte whose bit 0 lands on row top, only rows y1..y2 */
+static void ssd1309_DrawColumnBits(SSD1309_t *dev, int16_t x, int16_t top, uint8_t bits, int16_t y1, int16_t y2,
+                                   SSD1309_COLOR color)
+{
+    int16_t page    = (top >= 0) ? (top / 8) : -((7 - top) / 8);
+    int16_t low     = y1 - page * 8;
+    int16_t high    = y2 - page * 8;
+    uint16_t value  = (uint16_t)bits << (top - page * 8);
+    SSD1309_INK ink = ssd1309_Ink(color);
+
+    /* Rows of value: page * 8 onwards, y1..y2 lie on the screen */
+    value &= (low > 15) ? 0 : (uint16_t)(0xFFFF << ((low < 0) ? 0 : low));
+    value &= (high < 0) ? 0 : (uint16_t)(0xFFFF >> ((high > 15) ? 0 : (15 - high)));
+
+    for (uint8_t i = 0; i < 2; i++, page++, value >>= 8)
+    {
+        uint8_t *pixel;
+
+        if ((value & 0xFF) == 0)
+        {
+            continue;
+        }
+
+        pixel = &dev->Buffer[dev->Width * page + x];
+
+        SSD1309_TRACE_BYTES(dev, pixel - dev->Buffer, 1);
+
+        *pixel = ssd1309_ApplyInk(*pixel, (uint8_t)value, ink);
+    }
+}
+
+
+/* Glyph of a code point, NULL if the font has none */
+static const SSD1309_Glyph_t *ssd1309_FindGlyph(const SSD1309_Font_t *Font, uint16_t code)
+{
+    uint16_t index = code - Font->First;
+    uint16_t low   = 0;
+    uint16_t high  = Font->Count;
+
+    if (code < Font->First)
+    {
+        return NULL;
+    }
+
+    if (NULL == Font->Codepoints)
+    {
+        return (index < Font->Count) ? &Font->Glyphs[index] : NULL;
+    }
+
+    /* Code points are unique and sorted, so a run from First is found in place */
+    if ((index < Font->Count) && (Font->Codepoints[index] == code))
+    {
+        return &Font->Glyphs[index];
+    }
+
+    while (low < high)
+    {
+        uint16_t middle = low + (high - low) / 2;
+
+        if (Font->Codepoints[middle] < code)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return ((low < Font->Count) && (Font->Codepoints[low] == code)) ? &Font->Glyphs[low] : NULL;
+}
+
+
+/* Next code point of a UTF-8 string, U+FFFD for a malformed or non-BMP sequence */
+static uint16_t ssd1309_Utf8Next(const char **str)
+{
+    const uint8_t *byte = (const uint8_t *)*str;
+    uint16_t code       = 0xFFFD;
+    uint8_t follow      = 0;
+
+    if (byte[0] < 0x80)
+    {
+        code = byte[0];
+    }
+    else if ((byte[0] >= 0xC2) && (byte[0] < 0xE0))
+    {
+        code   = byte[0] & 0x1F;
+        follow = 1;
+    }
+    else if ((byte[0] >= 0xE0) && (byte[0] < 0xF0))
+    {
+        code   = byte[0] & 0x0F;
+        follow = 2;
+    }
+    else
+    {
+        /* Nothing to do */
+    }
+
+    byte++;
+
+    for (uint8_t i = 0; i < follow; i++, byte++)
+    {
+        if ((*byte & 0xC0) != 0x80)
+        {
+            *str = (const char *)byte;
+            return 0xFFFD;
+        }
+
+        code = (code << 6) | (*byte & 0x3F);
+    }
+
+    /* Overlong 3 byte forms and UTF-16 surrogates */
+    if ((follow == 2) && ((code < 0x800) || ((code >= 0xD800) && (code < 0xE000))))
+    {
+        code = 0xFFFD;
+    }
+
+    /* Skip the continuation bytes of whatever was not decoded */
+    while ((follow == 0) && (code == 0xFFFD) && ((*byte & 0xC0) == 0x80))
+    {
+        byte++;
+    }
+
+    *str = (const char *)byte;
+
+    return code;
+}
+
+
+/* Portrait DrawGlyph, the glyph box clipped to x1..x2, y1..y2: the decoded columns */
+/* are gathered into blocks and written as screenbuffer rows                      */
+static void ssd1309_DrawGlyphPortrait(SSD1309_t *dev, int16_t x, int16_t y, const SSD1309_Glyph_t *glyph,
+                                      SSD1309_RLE *rle, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                                      SSD1309_COLOR color)
+{
+    SSD1309_BLOCK block = {0, 0, 0, -1, 0};
+    SSD1309_INK ink     = ssd1309_Ink(color);
+    uint8_t bands       = (glyph->Height + 7) / 8;
+
+    for (uint8_t band = 0; (band < bands) && ((y + band * 8) <= y2); band++)
+    {
+        int16_t top  = y + band * 8;
+        uint8_t rows = ssd1309_RowsMask(top, y1, y2);
+
+        for (int16_t column = x; column < (x + glyph->Width); column++)
+        {
+            uint8_t bits = ssd1309_RleNext(rle) & rows;
+
+            if ((bits != 0) && (column >= x1) && (column <= x2))
+            {
+                ssd1309_PutBlock(dev, &block, column, top, bits & ink.Set, bits & ink.Clear, bits & ink.Toggle);
+            }
+        }
+    }
+
+    ssd1309_FlushBlock(dev, &block);
+}
+
+
+/* Decode a glyph straight into the screenbuffer with its box at x, y, clipped to */
+/* clip, which lies on the screen: set bits are drawn in color, the others are left */
+static void ssd1309_DrawGlyph(SSD1309_t *dev, int16_t x, int16_t y, const SSD1309_Glyph_t *glyph,
+                              const uint8_t *bitmaps, const SSD1309_RECT *clip, SSD1309_COLOR color)
+{
+    SSD1309_RLE rle = {&bitmaps[glyph->Offset], 0, 0, false};
+    uint8_t bands   = (glyph->Height + 7) / 8;
+    int16_t x1      = (x < clip->x1) ? clip->x1 : x;
+    int16_t y1      = (y < clip->y1) ? clip->y1 : y;
+    int16_t x2      = x + glyph->Width - 1;
+    int16_t y2      = y + glyph->Height - 1;
+
+    if (x2 > clip->x2)
+    {
+        x2 = clip->x2;
+    }
+
+    if (y2 > clip->y2)
+    {
+        y2 = clip->y2;
+    }
+
+    if ((glyph->Width == 0) || (x1 > x2) || (y1 > y2))
+    {
+        return;
+    }
+
+    ssd1309_MarkArea(dev, x1, y1, x2, y2);
+    SSD1309_STATS_ADD(dev, Pixels, (uint32_t)(x2 - x1 + 1) * (y2 - y1 + 1));
+
+    if (SSD1309_PORTRAIT(dev))
+    {
+        ssd1309_DrawGlyphPortrait(dev, x, y, glyph, &rle, x1, y1, x2, y2, color);
+        return;
+    }
+
+    /* Bands below the clip are never decoded */
+    for (uint8_t band = 0; (band < bands) && ((y + band * 8) <= y2); band++)
+    {
+        for (int16_t column = x; column < (x + glyph->Width); column++)
+        {
+            uint8_t bits = ssd1309_RleNext(&rle);
+
+            if ((bits != 0) && (column >= x1) && (column <= x2))
+            {
+                ssd1309_DrawColumnBits(dev, column, y + band * 8, bits, y1, y2, color);
+            }
+        }
+    }
+}
+
+
+/* Draw 1 glyph of a proportional font at the cursor and advance it */
+uint16_t ssd1309_WriteGlyph(SSD1309_t *dev, uint16_t code, const SSD1309_Font_t *Font, SSD1309_COLOR color)
+{
+    const SSD1309_Glyph_t *glyph = ssd1309_FindGlyph(Font, code);
+
+    if (NULL == glyph)
+    {
+        return 0;
+    }
+
+    ssd1309_DrawGlyph(dev, dev->OriginX + (int16_t)dev->CurrentX + glyph->XOffset,
+                      dev->OriginY + (int16_t)dev->CurrentY + glyph->YOffset, glyph, Font->Bitmaps, &dev->Clip, color);
+    dev->CurrentX += glyph->Advance;
+
+    return code;
+}
+
+
+/* Write UTF-8 string in a proportional font to the screenbuffer */
+void ssd1309_WriteText(SSD1309_t *dev, const char *str, const SSD1309_Font_t *Font, SSD1309_COLOR color)
+{
+    while (*str)
+    {
+        ssd1309_WriteGlyph(dev, ssd1309_Utf8Next(&str), Font, color);
+    }
+}
+
+
+/* One line of str up to a newline, or up to the last break that fits max_width when wrapping: */
+/* its width to the right of the last ink, its end and the start of the next line         */
+static uint16_t ssd1309_LayoutLine(const char *str, const SSD1309_Font_t *Font, uint16_t max_width,
+                                   SSD1309_WRAP wrap, const char **end, const char **next)
+{
+    const char *cursor = str;
+    const char *brk    = NULL;
+    uint16_t brk_width = 0;
+    uint16_t width     = 0;
+    int16_t pen        = 0;
+
+    while ((*cursor != '\0') && (*cursor != '\n'))
+    {
+        const char *following        = cursor;
+        uint16_t code                = ssd1309_Utf8Next(&following);
+        const SSD1309_Glyph_t *glyph = ssd1309_FindGlyph(Font, code);
+        int16_t ink;
+
+        if (NULL == glyph)
+        {
+            cursor = following;
+            continue;
+        }
+
+        ink = pen + glyph->XOffset + glyph->Width;
+
+        /* Every line keeps at least its first glyph */
+        if ((wrap != SSD1309_WRAP_NONE) && (glyph->Width != 0) && (ink > max_width) && (cursor != str))
+        {
+            if ((wrap == SSD1309_WRAP_WORD) && (brk != NULL))
+            {
+                *end  = brk;
+                *next = brk;
+                return brk_width;
+            }
+
+            *end  = cursor;
+            *next = cursor;
+            return width;
+        }
+
+        if ((code == ' ') && (cursor != str))
+        {
+            brk       = cursor;
+            brk_width = width;
+        }
+
+        if ((glyph->Width != 0) && (ink > width))
+        {
+            width = ink;
+        }
+
+        pen   += glyph->Advance;
+        cursor = following;
+    }
+
+    *end  = cursor;
+    *next = (*cursor == '\n') ? (cursor + 1) : cursor;
+
+    return width;
+}
+
+
+/* Size of a UTF-8 string in a proportional font */
+uint16_t ssd1309_MeasureString(const char *str, const SSD1309_Font_t *Font, uint16_t *height)
+{
+    uint16_t width = 0;
+    uint16_t lines = 0;
+
+    while (*str)
+    {
+        const char *end;
+        uint16_t line = ssd1309_LayoutLine(str, Font, UINT16_MAX, SSD1309_WRAP_NONE, &end, &str);
+
+        if (line > width)
+        {
+            width = line;
+        }
+
+        lines++;
+    }
+
+    if (NULL != height)
+    {
+        *height = lines * Font->Height;
+    }
+
+    return width;
+}
+
+
+/* Lay out a UTF-8 string in a box: break lines once, align them and draw them clipped to the box */
+const char *ssd1309_DrawText(SSD1309_t *dev, const SSD1309_RECT *rect, const char *str, const SSD1309_Font_t *Font,
+                             SSD1309_ALIGN align, SSD1309_WRAP wrap, SSD1309_COLOR color)
+{
+    uint16_t box   = rect->x2 - rect->x1 + 1;
+    int16_t left   = dev->OriginX + rect->x1;
+    int16_t y      = dev->OriginY + rect->y1;
+    int16_t bottom = dev->OriginY + rect->y2;
+    int16_t x1     = left;
+    int16_t y1     = y;
+    int16_t x2     = dev->OriginX + rect->x2;
+    int16_t y2     = bottom;
+    bool visible;
+    SSD1309_RECT clip;
+
+    if ((rect->x1 > rect->x2) || (rect->y1 > rect->y2))
+    {
+        return str;
+    }
+
+    /* The part of the box inside the clip, the lines are laid out in the whole box */
+    visible = ssd1309_ClipBox(dev, &x1, &y1, &x2, &y2);
+    clip.x1 = x1;
+    clip.y1 = y1;
+    clip.x2 = x2;
+    clip.y2 = y2;
+
+    while ((*str != '\0') && (y <= bottom))
+    {
+        const char *line = str;
+        const char *end;
+        const char *next;
+        uint16_t width = ssd1309_LayoutLine(line, Font, box, wrap, &end, &next);
+        int16_t x      = left;
+
+        if (align == SSD1309_ALIGN_CENTER)
+        {
+            x += ((int16_t)box - (int16_t)width) / 2;
+        }
+        else if (align == SSD1309_ALIGN_RIGHT)
+        {
+            x += (int16_t)box - (int16_t)width;
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+
+        while (visible && (line < end))
+        {
+            const SSD1309_Glyph_t *glyph = ssd1309_FindGlyph(Font, ssd1309_Utf8Next(&line));
+
+            if (NULL == glyph)
+            {
+                continue;
+            }
+
+            ssd1309_DrawGlyph(dev, x + glyph->XOffset, y + glyph->YOffset, glyph, Font->Bitmaps, &clip, color);
+            x += glyph->Advance;
+        }
+
+        /* A line cut off by the bottom of the box is left to the caller as well */
+        if ((y + Font->Height - 1) > bottom)
+        {
+            break;
+        }
+
+        str = next;
+
+        /* A wrapped line does not start with the spaces it broke at */
+        while ((next == end) && (*str == ' '))
+        {
+            str++;
+        }
+
+        y += Font->Height;
+    }
+
+    return str;
+}
+
+
+/* Write full string to screenbuffer */
+char ssd1309_WriteString(SSD1309_t *dev, char* str, FontDef Font, SSD1309_COLOR color) 
+{
+    /* Write until null-byte */
+    while (*str) 
+    {
+        if (ssd1309_WriteChar(dev, *str, Font, color) != *str) 
+        {
+            /* Char could not be written */
+            return *str;
+        }
+    
+        /* Next char */
+        str++;
+    }
+    
+    /* Everything ok */
+    return *str;
+}
+
+
+/* Position the cursor */
+void ssd1309_SetCursor(SSD1309_t *dev, uint8_t x, uint8_t y) 
+{
+    if (SSD1309_PORTRAIT(dev))
+    {
+        /* Rows of the screen run along the columns, the first one lands on the last RAM column */
+        dev->CurrentX = x - dev->OffsetY;
+        dev->CurrentY = y + dev->Width + dev->OffsetX - SSD1309_COLUMNS;
+    }
+    else
+    {
+        dev->CurrentX = x - dev->OffsetX;
+        dev->CurrentY = y - dev->OffsetY;
+    }
+}
+
+
+/* Draw horizontal line, one bit mask ORed across the column run */
+void ssd1309_DrawHLine(SSD1309_t *dev, uint8_t x1, uint8_t x2, uint8_t y, SSD1309_COLOR color)
+{
+    uint8_t x_start = ((x1 <= x2) ? x1 : x2);
+    uint8_t x_end   = ((x1 <= x2) ? x2 : x1);
+
+    ssd1309_FillClipped(dev, dev->OriginX + x_start, dev->OriginY + y, dev->OriginX + x_end, dev->OriginY + y, color);
+}
+
+
+/* Draw vertical line, whole bytes per page with masks at both ends */
+void ssd1309_DrawVLine(SSD1309_t *dev, uint8_t x, uint8_t y1, uint8_t y2, SSD1309_COLOR color)
+{
+    uint8_t y_start = ((y1 <= y2) ? y1 : y2);
+    uint8_t y_end   = ((y1 <= y2) ? y2 : y1);
+
+    ssd1309_FillClipped(dev, dev->OriginX + x, dev->OriginY + y_start, dev->OriginX + x, dev->OriginY + y_end, color);
+}
+
+
+/* Draw 45 degree line of length pixels rightwards from x,y of the rotated screen, going down (dir 1) */
+/* or up (dir -1): the byte pointer and bit mask are stepped instead of addressing every pixel       */
+static void ssd1309_DrawDiagonal(SSD1309_t *dev, int16_t x, int16_t y, uint16_t length, int8_t dir, SSD1309_COLOR color)
+{
+    int16_t first   = 0;
+    int16_t last    = length - 1;
+    SSD1309_INK ink = ssd1309_Ink(color);
+    uint8_t *pixel;
+    uint8_t mask;
+
+    /* Steps of the line inside the columns, then inside the rows of the clip */
+    if (first < (dev->Clip.x1 - x))
+    {
+        first = dev->Clip.x1 - x;
+    }
+
+    if (last > (dev->Clip.x2 - x))
+    {
+        last = dev->Clip.x2 - x;
+    }
+
+    if (first < ((dir > 0) ? (dev->Clip.y1 - y) : (y - dev->Clip.y2)))
+    {
+        first = (dir > 0) ? (dev->Clip.y1 - y) : (y - dev->Clip.y2);
+    }
+
+    if (last > ((dir > 0) ? (dev->Clip.y2 - y) : (y - dev->Clip.y1)))
+    {
+        last = (dir > 0) ? (dev->Clip.y2 - y) : (y - dev->Clip.y1);
+    }
+
+    if (first > last)
+    {
+        return;
+    }
+
+    x     += first;
+    y     += dir * first;
+    length = last - first + 1;
+
+    /* Transposed, the line still runs at 45 degrees: step it from its leftmost screenbuffer column */
+    if (SSD1309_PORTRAIT(dev))
+    {
+        int16_t column = SSD1309_PORTRAIT_COLUMN(dev, (dir > 0) ? (y + length - 1) : y);
+
+        y   = (dir > 0) ? (x + length - 1) : x;
+        x   = column;
+        dir = -dir;
+    }
+
+    ssd1309_MarkDirty(dev, x, x + length - 1,
+                      ((dir > 0) ? y : (y - (length - 1))) / 8, ((dir > 0) ? (y + (length - 1)) : y) / 8);
+    SSD1309_STATS_ADD(dev, Pixels, length);
+
+    pixel = &dev->Buffer[x + (y / 8) * dev->Width];
+    mask  = 1 << (y % 8);
+
+    for (uint16_t i = 0; i < length; i++)
+    {
+        SSD1309_TRACE_BYTES(dev, pixel - dev->Buffer, 1);
+
+        *pixel = ssd1309_ApplyInk(*pixel, mask, ink);
+
+        pixel++;
+
+        if (dir > 0)
+        {
+            mask <<= 1;
+            if (mask == 0)
+            {
+                mask   = 0x01;
+                pixel += dev->Width;
+            }
+        }
+        else
+        {
+            mask >>= 1;
+            if (mask == 0)
+            {
+                mask   = 0x80;
+                pixel -= dev->Width;
+            }
+        }
+    }
+}
+
+
+/* Draw the line from x, y of the rotated screen to x + dx, y + dy, neither straight nor */
+/* at 45 degrees. Pixel i along the major axis is (2 i minor + major - 1) / (2 major)    */
+/* steps along the minor axis, the pixels of Bresenham's algorithm: the steps inside the */
+/* clip are solved for first, then walked unchecked in screenbuffer coordinates          */
+static void ssd1309_DrawSlope(SSD1309_t *dev, int16_t x, int16_t y, int16_t dx, int16_t dy, SSD1309_COLOR color)
+{
+    bool steep     = abs(dy) > abs(dx);
+    int32_t major  = steep ? abs(dy) : abs(dx);
+    int32_t minor  = steep ? abs(dx) : abs(dy);
+    int8_t sign_x  = (dx < 0) ? -1 : 1;
+    int8_t sign_y  = (dy < 0) ? -1 : 1;
+    int32_t first  = 0;
+    int32_t last   = major;
+    int32_t p      = steep ? y : x;
+    int32_t q      = steep ? x : y;
+    int8_t sign_p  = steep ? sign_y : sign_x;
+    int8_t sign_q  = steep ? sign_x : sign_y;
+    int32_t p_low  = steep ? dev->Clip.y1 : dev->Clip.x1;
+    int32_t p_high = steep ? dev->Clip.y2 : dev->Clip.x2;
+    int32_t q_low  = steep ? dev->Clip.x1 : dev->Clip.y1;
+    int32_t q_high = steep ? dev->Clip.x2 : dev->Clip.y2;
+    int32_t low;
+    int32_t high;
+    int32_t error;
+    int16_t px;
+    int16_t py;
+    int8_t major_x;
+    int8_t major_y;
+    int8_t minor_x;
+    int8_t minor_y;
+
+    /* Major steps inside the clip */
+    low  = (sign_p > 0) ? (p_low - p) : (p - p_high);
+    high = (sign_p > 0) ? (p_high - p) : (p - p_low);
+
+    if (first < low)
+    {
+        first = low;
+    }
+
+    if (last > high)
+    {
+        last = high;
+    }
+
+    /* Minor steps inside the clip, turned into the major steps that reach them */
+    low  = (sign_q > 0) ? (q_low - q) : (q - q_high);
+    high = (sign_q > 0) ? (q_high - q) : (q - q_low);
+
+    if (high < 0)
+    {
+        return;
+    }
+
+    if ((low > 0) && (first < ((2 * low * major - major + 2 * minor) / (2 * minor))))
+    {
+        first = (2 * low * major - major + 2 * minor) / (2 * minor);
+    }
+
+    if ((high < minor) && (last > ((2 * (high + 1) * major - major) / (2 * minor))))
+    {
+        last = (2 * (high + 1) * major - major) / (2 * minor);
+    }
+
+    if (first > last)
+    {
+        return;
+    }
+
+    /* Position of the first visible pixel, error in units of 1 / (2 major) minor steps */
+    error = 2 * first * minor + major - 1;
+    p    += sign_p * first;
+    q    += sign_q * (error / (2 * major));
+    error = error % (2 * major);
+
+    px      = steep ? q : p;
+    py      = steep ? p : q;
+    major_x = steep ? 0 : sign_x;
+    major_y = steep ? sign_y : 0;
+    minor_x = steep ? sign_x : 0;
+    minor_y = steep ? 0 : sign_y;
+
+    /* Transposed, (x, y) is screenbuffer (Width - 1 - y, x) and a step (a, b) is (-b, a) */
+    if (SSD1309_PORTRAIT(dev))
+    {
+        int16_t column = SSD1309_PORTRAIT_COLUMN(dev, py);
+        int8_t step    = major_x;
+
+        py      = px;
+        px      = column;
+        major_x = -major_y;
+        major_y = step;
+        step    = minor_x;
+        minor_x = -minor_y;
+        minor_y = step;
+    }
+
+    for (int32_t i = first; i <= last; i++)
+    {
+        ssd1309_SetPixel(dev, px, py, color);
+
+        px    += major_x;
+        py    += major_y;
+        error += 2 * minor;
+
+        if (error >= (2 * major))
+        {
+            error -= 2 * major;
+            px    += minor_x;
+            py    += minor_y;
+        }
+    }
+}
+
+
+/* Draw the line x1, y1 to x2, y2 of the screen, straight and 45 degree lines go to */
+/* their kernels, the rest is clipped and stepped by DrawSlope                      */
+static void ssd1309_DrawSegment(SSD1309_t *dev, int16_t x1, int16_t y1, int16_t x2, int16_t y2, SSD1309_COLOR color)
+{
+    int16_t deltaX = abs(x2 - x1);
+    int16_t deltaY = abs(y2 - y1);
+
+    if (deltaY == 0)
+    {
+        ssd1309_FillClipped(dev, (x1 < x2) ? x1 : x2, y1, (x1 < x2) ? x2 : x1, y1, color);
+        return;
+    }
+
+    if (deltaX == 0)
+    {
+        ssd1309_FillClipped(dev, x1, (y1 < y2) ? y1 : y2, x1, (y1 < y2) ? y2 : y1, color);
+        return;
+    }
+
+    if (deltaX == deltaY)
+    {
+        /* Drawn left to right */
+        if (x1 < x2)
+        {
+            ssd1309_DrawDiagonal(dev, x1, y1, deltaX + 1, (y1 < y2) ? 1 : -1, color);
+        }
+        else
+        {
+            ssd1309_DrawDiagonal(dev, x2, y2, deltaX + 1, (y2 < y1) ? 1 : -1, color);
+        }
+        return;
+    }
+
+    ssd1309_DrawSlope(dev, x1, y1, x2 - x1, y2 - y1, color);
+}
+
+
+/* Draw line */
+void ssd1309_DrawLine(SSD1309_t *dev, uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1309_COLOR color)
+{
+    ssd1309_DrawSegment(dev, dev->OriginX + x1, dev->OriginY + y1, dev->OriginX + x2, dev->OriginY + y2, color);
+}
+
+
+/* Fill the span x1..x2 (x1 <= x2) of row y, clipped */
+static void ssd1309_FillSpan(SSD1309_t *dev, int16_t x1, int16_t x2, int16_t y, SSD1309_COLOR color)
+{
+    ssd1309_FillClipped(dev, x1, y, x2, y, color);
+}
+
+
+/* Draw circle by Bresenhem's algorithm */
+void ssd1309_DrawCircle(SSD1309_t *dev, uint8_t par_x, uint8_t par_y, uint8_t par_r, SSD1309_COLOR color)
+{
+    int16_t cx = dev->OriginX + par_x;
+    int16_t cy = dev->OriginY + par_y;
+    int32_t x = -par_r;
+    int32_t y = 0;
+    int32_t err = 2 - 2 * par_r;
+    int32_t e2;
+    bool inside;
+
+    /* Points are only checked against the clip when it cuts the circle */
+    if (!ssd1309_ClipTest(dev, cx - par_r, cy - par_r, cx + par_r, cy + par_r, &inside))
+    {
+        return;
+    }
+
+    do {
+        /* Points on the axes are drawn once, Inverse would undo them */
+        ssd1309_PlotPoint(dev, cx - x, cy + y, inside, color);
+
+        if (x != 0)
+        {
+            ssd1309_PlotPoint(dev, cx + x, cy + y, inside, color);
+        }
+
+        if ((x != 0) && (y != 0))
+        {
+            ssd1309_PlotPoint(dev, cx + x, cy - y, inside, color);
+        }
+
+        if (y != 0)
+        {
+            ssd1309_PlotPoint(dev, cx - x, cy - y, inside, color);
+        }
+
+        e2 = err;
+
+        if (e2 <= y)
+        {
+            y++;
+            err = err + (y * 2 + 1);
+
+            if (-x == y && e2 <= x)
+            {
+                e2 = 0;
+            }
+            else
+            {
+                /* Nothing to do */
+            }
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+
+        if (e2 > x)
+        {
+            x++;
+            err = err + (x * 2 + 1);
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+    } while (x <= 0);
+
+    return;
+}
+
+
+/* Draw filled circle, one span per row from the outline of Bresenham's algorithm */
+void ssd1309_FillCircle(SSD1309_t *dev, uint8_t par_x,uint8_t par_y,uint8_t par_r, SSD1309_COLOR par_color)
+{
+    int16_t cx = dev->OriginX + par_x;
+    int16_t cy = dev->OriginY + par_y;
+    int32_t x = -par_r;
+    int32_t y = 0;
+    int32_t err = 2 - 2 * par_r;
+    int32_t e2;
+    int32_t last_y = -1;
+    bool inside;
+
+    if (!ssd1309_ClipTest(dev, cx - par_r, cy - par_r, cx + par_r, cy + par_r, &inside))
+    {
+        return;
+    }
+
+    do {
+        /* The first point reached on a row is the widest */
+        if (y != last_y)
+        {
+            ssd1309_FillSpan(dev, cx + x, cx - x, cy + y, par_color);
+
+            if (y != 0)
+            {
+                ssd1309_FillSpan(dev, cx + x, cx - x, cy - y, par_color);
+            }
+
+            last_y = y;
+        }
+
+        e2 = err;
+
+        if (e2 <= y)
+        {
+            y++;
+            err = err + (y * 2 + 1);
+
+            if (-x == y && e2 <= x)
+            {
+                e2 = 0;
+            }
+            else
+            {
+                /* Nothing to do */
+            }
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+
+        if (e2 > x)
+        {
+            x++;
+            err = err + (x * 2 + 1);
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+    } while (x <= 0);
+}
+
+
+/* sin() of 0 to 90 degrees in Q14, the other quadrants are folded onto it */
+static const int16_t SSD1309_SineTable[91] =
+{
+        0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+     2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+     5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+     8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384
+};
+
+/* Sector between two angles, the directions are (sin, cos) in Q14 */
+typedef struct
+{
+    int32_t StartX;     /* Direction of the start angle              */
+    int32_t StartY;
+    int32_t EndX;       /* Direction of the end angle                */
+    int32_t EndY;
+    uint16_t Sweep;     /* Degrees from start to end, 360 and up: all */
+} SSD1309_SECTOR;
+
+/* Outline of Bresenham's circle, walked one row at a time */
+typedef struct
+{
+    int32_t X;
+    int32_t Y;
+    int32_t Err;
+} SSD1309_CIRCLE_ROWS;
+
+
+/* sin() of angle in degrees, Q14 */
+static int32_t ssd1309_Sin(uint16_t angle)
+{
+    angle %= 360;
+
+    if (angle <= 90)
+    {
+        return SSD1309_SineTable[angle];
+    }
+    else if (angle <= 180)
+    {
+        return SSD1309_SineTable[180 - angle];
+    }
+    else if (angle <= 270)
+    {
+        return -SSD1309_SineTable[angle - 180];
+    }
+    else
+    {
+        return -SSD1309_SineTable[360 - angle];
+    }
+}
+
+
+/* Point radius away from x, y at angle, rounded half away from the centre */
+static void ssd1309_ArcPoint(int16_t x, int16_t y, uint8_t radius, uint16_t angle, int16_t *px, int16_t *py)
+{
+    int32_t dx = ssd1309_Sin(angle) * radius;
+    int32_t dy = ssd1309_Sin((angle % 360) + 90) * radius;
+
+    *px = x + (dx + ((dx < 0) ? -8192 : 8192)) / 16384;
+    *py = y + (dy + ((dy < 0) ? -8192 : 8192)) / 16384;
+}
+
+
+/* Sector from start_angle to end_angle, an end below the start wraps through 0 */
+static void ssd1309_MakeSector(SSD1309_SECTOR *sector, uint16_t start_angle, uint16_t end_angle)
+{
+    start_angle %= 360;
+
+    if (end_angle >= start_angle)
+    {
+        sector->Sweep = end_angle - start_angle;
+    }
+    else
+    {
+        sector->Sweep = 360 - ((start_angle - end_angle) % 360);
+    }
+
+    sector->StartX = ssd1309_Sin(start_angle);
+    sector->StartY = ssd1309_Sin(start_angle + 90);
+    sector->EndX   = ssd1309_Sin(start_angle + sector->Sweep);
+    sector->EndY   = ssd1309_Sin(start_angle + sector->Sweep + 90);
+}
+
+
+/* Whether dx, dy from the centre lies in the sector. Side of a direction V: */
+/* V.y * dx - V.x * dy, positive when the point comes after V                */
+static bool ssd1309_InSector(const SSD1309_SECTOR *sector, int32_t dx, int32_t dy)
+{
+    int32_t start = sector->StartY * dx - sector->StartX * dy;
+    int32_t end   = sector->EndY * dx - sector->EndX * dy;
+
+    if (sector->Sweep >= 360)
+    {
+        return true;
+    }
+
+    if (sector->Sweep > 180)
+    {
+        /* All but the open wedge from the end back to the start */
+        return !((end > 0) && (start < 0));
+    }
+
+    /* Below 90 degrees the opposite wedge would pass both sides */
+    if ((sector->Sweep < 90) && ((sector->StartX * dx + sector->StartY * dy) < 0))
+    {
+        return false;
+    }
+
+    return (start >= 0) && (end <= 0);
+}
+
+
+/* Floor of a / b, b != 0 */
+static inline int32_t ssd1309_FloorDiv(int32_t a, int32_t b)
+{
+    int32_t q = a / b;
+
+    if (((a % b) != 0) && ((a < 0) != (b < 0)))
+    {
+        q--;
+    }
+    else
+    {
+        /* Nothing to do */
+    }
+
+    return q;
+}
+
+
+/* Narrow lo..hi to the dx of a row with a * dx >= b */
+static void ssd1309_HalfRow(int32_t a, int32_t b, int32_t *lo, int32_t *hi)
+{
+    int32_t bound;
+
+    if (a > 0)
+    {
+        bound = -ssd1309_FloorDiv(-b, a);
+        *lo   = (bound > *lo) ? bound : *lo;
+    }
+    else if (a < 0)
+    {
+        bound = ssd1309_FloorDiv(b, a);
+        *hi   = (bound < *hi) ? bound : *hi;
+    }
+    else if (b > 0)
+    {
+        *hi = *lo - 1;
+    }
+    else
+    {
+        /* Nothing to do */
+    }
+}
+
+
+/* dx of row dy in the sector within -r..r, as up to two ranges lo[i]..hi[i] */
+/* (empty when lo[i] > hi[i]), solved from the same sides as InSector        */
+static void ssd1309_SectorRow(const SSD1309_SECTOR *sector, int32_t dy, int32_t r, int32_t lo[2], int32_t hi[2])
+{
+    lo[0] = -r;
+    hi[0] = r;
+    lo[1] = 1;
+    hi[1] = 0;
+
+    if (sector->Sweep >= 360)
+    {
+        return;
+    }
+
+    if (sector->Sweep > 180)
+    {
+        /* The open wedge end..start splits the row */
+        int32_t gap_lo = -r;
+        int32_t gap_hi = r;
+
+        ssd1309_HalfRow(sector->EndY, sector->EndX * dy + 1, &gap_lo, &gap_hi);
+        ssd1309_HalfRow(-sector->StartY, 1 - sector->StartX * dy, &gap_lo, &gap_hi);
+
+        if (gap_lo <= gap_hi)
+        {
+            hi[0] = gap_lo - 1;
+            lo[1] = gap_hi + 1;
+            hi[1] = r;
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+
+        return;
+    }
+
+    if (sector->Sweep < 90)
+    {
+        ssd1309_HalfRow(sector->StartX, -sector->StartY * dy, &lo[0], &hi[0]);
+    }
+    else
+    {
+        /* Nothing to do */
+    }
+
+    ssd1309_HalfRow(sector->StartY, sector->StartX * dy, &lo[0], &hi[0]);
+    ssd1309_HalfRow(-sector->EndY, -sector->EndX * dy, &lo[0], &hi[0]);
+}
+
+
+/* Start the outline of a circle of radius r at its middle row */
+static inline void ssd1309_CircleStart(SSD1309_CIRCLE_ROWS *rows, int32_t r)
+{
+    rows->X   = -r;
+    rows->Y   = 0;
+    rows->Err = 2 - 2 * r;
+}
+
+
+/* Half width of the current row, the first point reached on a row is the widest, */
+/* then step the outline to the next row. Same steps as DrawCircle and FillCircle */
+static int32_t ssd1309_CircleNext(SSD1309_CIRCLE_ROWS *rows)
+{
+    int32_t half = -rows->X;
+    int32_t row  = rows->Y;
+    int32_t e2;
+
+    while ((rows->Y == row) && (rows->X <= 0))
+    {
+        e2 = rows->Err;
+
+        if (e2 <= rows->Y)
+        {
+            rows->Y++;
+            rows->Err += rows->Y * 2 + 1;
+
+            if (-rows->X == rows->Y && e2 <= rows->X)
+            {
+                e2 = 0;
+            }
+            else
+            {
+                /* Nothing to do */
+            }
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+
+        if (e2 > rows->X)
+        {
+            rows->X++;
+            rows->Err += rows->X * 2 + 1;
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+    }
+
+    return half;
+}
+
+
+/* Fill the part of row cy + dy inside half width outer, outside half width inner */
+/* (-1 for no hole on the row) and in the sector                                  */
+static void ssd1309_FillSectorRow(SSD1309_t *dev, const SSD1309_SECTOR *sector, int16_t cx, int16_t cy, int32_t dy,
+                                  int32_t outer, int32_t inner, SSD1309_COLOR color)
+{
+    int32_t lo[2];
+    int32_t hi[2];
+    int32_t x1;
+    int32_t x2;
+
+    ssd1309_SectorRow(sector, dy, outer, lo, hi);
+
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        if (inner < 0)
+        {
+            if (lo[i] <= hi[i])
+            {
+                ssd1309_FillSpan(dev, cx + lo[i], cx + hi[i], cy + dy, color);
+            }
+            else
+            {
+                /* Nothing to do */
+            }
+
+            continue;
+        }
+
+        /* Left of the hole */
+        x1 = lo[i];
+        x2 = (hi[i] < -inner - 1) ? hi[i] : (-inner - 1);
+
+        if (x1 <= x2)
+        {
+            ssd1309_FillSpan(dev, cx + x1, cx + x2, cy + dy, color);
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+
+        /* Right of the hole */
+        x1 = (lo[i] > inner + 1) ? lo[i] : (inner + 1);
+        x2 = hi[i];
+
+        if (x1 <= x2)
+        {
+            ssd1309_FillSpan(dev, cx + x1, cx + x2, cy + dy, color);
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+    }
+}
+
+
+/* Fill the pixels of FillCircle(radius) that are not in FillCircle(inner) and lie */
+/* in the sector, inner -1 for none. One to four spans per row                     */
+static void ssd1309_FillSector(SSD1309_t *dev, uint8_t x, uint8_t y, uint8_t radius, int16_t inner,
+                               uint16_t start_angle, uint16_t end_angle, SSD1309_COLOR color)
+{
+    int16_t cx = dev->OriginX + x;
+    int16_t cy = dev->OriginY + y;
+    SSD1309_SECTOR sector;
+    SSD1309_CIRCLE_ROWS outer_rows;
+    SSD1309_CIRCLE_ROWS inner_rows;
+    int32_t outer;
+    int32_t hole;
+    bool inside;
+
+    if (!ssd1309_ClipTest(dev, cx - radius, cy - radius, cx + radius, cy + radius, &inside))
+    {
+        return;
+    }
+
+    ssd1309_MakeSector(&sector, start_angle, end_angle);
+    ssd1309_CircleStart(&outer_rows, radius);
+    ssd1309_CircleStart(&inner_rows, inner);
+
+    for (int32_t dy = 0; dy <= radius; dy++)
+    {
+        outer = ssd1309_CircleNext(&outer_rows);
+        hole  = (dy <= inner) ? ssd1309_CircleNext(&inner_rows) : -1;
+
+        /* Mirrored rows share the radial spans, not the sector */
+        ssd1309_FillSectorRow(dev, &sector, cx, cy, dy, outer, hole, color);
+
+        if (dy != 0)
+        {
+            ssd1309_FillSectorRow(dev, &sector, cx, cy, -dy, outer, hole, color);
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+    }
+}
+
+
+/* Draw the points of DrawCircle from start_angle to the end angle sweep,   */
+/* 0 is down and angles grow towards the right, an end below the start wraps */
+void ssd1309_DrawArc(SSD1309_t *dev, uint8_t x, uint8_t y, uint8_t radius, uint16_t start_angle, uint16_t sweep, SSD1309_COLOR color)
+{
+    int16_t cx = dev->OriginX + x;
+    int16_t cy = dev->OriginY + y;
+    SSD1309_SECTOR sector;
+    int32_t px = -radius;
+    int32_t py = 0;
+    int32_t err = 2 - 2 * radius;
+    int32_t e2;
+    bool inside;
+
+    if (!ssd1309_ClipTest(dev, cx - radius, cy - radius, cx + radius, cy + radius, &inside))
+    {
+        return;
+    }
+
+    ssd1309_MakeSector(&sector, start_angle, sweep);
+
+    do {
+        /* Points on the axes are drawn once, as in DrawCircle */
+        if (ssd1309_InSector(&sector, -px, py))
+        {
+            ssd1309_PlotPoint(dev, cx - px, cy + py, inside, color);
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+
+        if ((px != 0) && ssd1309_InSector(&sector, px, py))
+        {
+            ssd1309_PlotPoint(dev, cx + px, cy + py, inside, color);
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+
+        if ((px != 0) && (py != 0) && ssd1309_InSector(&sector, px, -py))
+        {
+            ssd1309_PlotPoint(dev, cx + px, cy - py, inside, color);
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+
+        if ((py != 0) && ssd1309_InSector(&sector, -px, -py))
+        {
+            ssd1309_PlotPoint(dev, cx - px, cy - py, inside, color);
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+
+        e2 = err;
+
+        if (e2 <= py)
+        {
+            py++;
+            err = err + (py * 2 + 1);
+
+            if (-px == py && e2 <= px)
+            {
+                e2 = 0;
+            }
+            else
+            {
+                /* Nothing to do */
+            }
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+
+        if (e2 > px)
+        {
+            px++;
+            err = err + (px * 2 + 1);
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+    } while (px <= 0);
+}
+
+
+/* Whether dx, dy from the centre is a point of DrawArc, found by its walk */
+static bool ssd1309_OnArc(uint8_t radius, uint16_t start_angle, uint16_t end_angle, int32_t dx, int32_t dy)
 {
-    SSD1309.CurrentX = x - SSD1309_OFFSET_X;
-    SSD1309.CurrentY = y - SSD1309_OFFSET_Y;
-}
-
+    SSD1309_SECTOR sector;
+    int32_t px = -radius;
+    int32_t py = 0;
+    int32_t err = 2 - 2 * radius;
+    int32_t e2;
 
-/* Draw line by Bresenhem's algorithm */
-void ssd1309_DrawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1309_COLOR color)
-{
-    int32_t deltaX = abs(x2 - x1);
-    int32_t deltaY = abs(y2 - y1);
-    int32_t signX = ((x1 < x2) ? 1 : -1);
-    int32_t signY = ((y1 < y2) ? 1 : -1);
-    int32_t error = deltaX - deltaY;
-    int32_t error2;
+    ssd1309_MakeSector(&sector, start_angle, end_angle);
 
-    ssd1309_DrawPixel(x2, y2, color);
-    while ((x1 != x2) || (y1 != y2))
+    if (!ssd1309_InSector(&sector, dx, dy))
     {
-        ssd1309_DrawPixel(x1, y1, color);
-        error2 = error * 2;
+        return false;
+    }
+
+    do {
+        if ((-px == abs(dx)) && (py == abs(dy)))
+        {
+            return true;
+        }
+
+        e2 = err;
 
-        if (error2 > -deltaY)
+        if (e2 <= py)
         {
-            error -= deltaY;
-            x1 += signX;
+            py++;
+            err = err + (py * 2 + 1);
+
+            if (-px == py && e2 <= px)
+            {
+                e2 = 0;
+            }
+            else
+            {
+                /* Nothing to do */
+            }
         }
         else
         {
-            /* Nothing to do */    
+            /* Nothing to do */
         }
-    
-        if (error2 < deltaX)
+
+        if (e2 > px)
         {
-            error += deltaX;
-            y1 += signY;
+            px++;
+            err = err + (px * 2 + 1);
         }
         else
         {
             /* Nothing to do */
         }
-    }
-    return;
+    } while (px <= 0);
+
+    return false;
 }
 
 
-/* DrawArc. Draw angle is beginning from 4 quart of trigonometric circle (3pi/2)
- * start_angle in degree
- * sweep in degree
- */
-void ssd1309_DrawArc(uint8_t x, uint8_t y, uint8_t radius, uint16_t start_angle, uint16_t sweep, SSD1309_COLOR color)
+/* Draw arc with the radius lines to its start and end point, angles as in DrawArc */
+void ssd1309_DrawArcWithRadiusLine(SSD1309_t *dev, uint8_t x, uint8_t y, uint8_t radius, uint16_t start_angle, uint16_t sweep, SSD1309_COLOR color)
 {
-    #define CIRCLE_APPROXIMATION_SEGMENTS 36
-    float approx_degree;
-    uint32_t approx_segments;
-    uint8_t xp1,xp2;
-    uint8_t yp1,yp2;
-    uint16_t loc_sweep = 0;
-    uint16_t loc_angle_count = 0;
-    uint32_t count = 0;
-    
-    float rad;
-    
-      loc_sweep = ssd1309_NormalizeTo0_360(sweep);
-      loc_angle_count = ssd1309_NormalizeTo0_360(start_angle);
-    
-    count = (loc_angle_count * CIRCLE_APPROXIMATION_SEGMENTS) / 360;
-    approx_segments = (loc_sweep * CIRCLE_APPROXIMATION_SEGMENTS) / 360;
-    approx_degree = loc_sweep / (float)approx_segments;
+    int16_t cx = dev->OriginX + x;
+    int16_t cy = dev->OriginY + y;
+    int16_t start_x;
+    int16_t start_y;
+    int16_t end_x;
+    int16_t end_y;
+    bool both;
+
+    ssd1309_ArcPoint(cx, cy, radius, start_angle, &start_x, &start_y);
+    ssd1309_ArcPoint(cx, cy, radius, sweep, &end_x, &end_y);
+    both = (end_x != start_x) || (end_y != start_y);
+
+    ssd1309_DrawArc(dev, x, y, radius, start_angle, sweep, color);
+    ssd1309_DrawSegment(dev, cx, cy, start_x, start_y, color);
+
+    if (both)
+    {
+        ssd1309_DrawSegment(dev, cx, cy, end_x, end_y, color);
+    }
+    else
+    {
+        /* Nothing to do */
+    }
 
-    while (count < approx_segments)
+    /* Inverse went over the centre with both lines and over the ends that lie on */
+    /* the arc with the line and the arc, invert them once more                  */
+    if (color == Inverse)
     {
-        xp1 = x + (int8_t)(sin(rad) * radius);
-        yp1 = y + (int8_t)(cos(rad) * radius);    
-        count++;
-#if 1
-        if (count != approx_segments)
+        if (both)
         {
-              rad = ssd1309_DegToRad(count * approx_degree);
-        }
-        else
-        {            
-            rad = ssd1309_DegToRad(loc_sweep);
+            ssd1309_DrawPixelClipped(dev, cx, cy, color);
         }
-#endif
-        xp2 = x + (int8_t)(sin(rad) * radius);
-        yp2 = y + (int8_t)(cos(rad) * radius);    
-        ssd1309_DrawLine(xp1, yp1, xp2, yp2, color);
-    }
-}
-
-
-/*
- * Draw arc with radius line
- * Angle is beginning from 4 quart of trigonometric circle (3pi/2)
- * start_angle: start angle in degree
- * sweep: finish angle in degree
- */
-void ssd1309_DrawArcWithRadiusLine(uint8_t x, uint8_t y, uint8_t radius, uint16_t start_angle, uint16_t sweep, SSD1309_COLOR color)
-{
-    static const uint8_t CIRCLE_APPROXIMATION_SEGMENTS = 36;
-    float approx_degree;
-    uint32_t approx_segments;
-    uint8_t xp1 = 0;
-    uint8_t xp2 = 0;
-    uint8_t yp1 = 0;
-    uint8_t yp2 = 0;
-    uint32_t count = 0;
-    uint32_t loc_sweep = 0;
-    float rad;
-    
-    loc_sweep = ssd1309_NormalizeTo0_360(sweep);
-    
-    count = (ssd1309_NormalizeTo0_360(start_angle) * CIRCLE_APPROXIMATION_SEGMENTS) / 360;
-    approx_segments = (loc_sweep * CIRCLE_APPROXIMATION_SEGMENTS) / 360;
-    approx_degree = loc_sweep / (float)approx_segments;
-
-    rad = ssd1309_DegToRad(count * approx_degree);
-    uint8_t first_point_x = x + (int8_t)(sin(rad)*radius);
-    uint8_t first_point_y = y + (int8_t)(cos(rad)*radius);
 
-    while (count < approx_segments)
-    {
-        rad = ssd1309_DegToRad(count*approx_degree);
-        xp1 = x + (int8_t)(sin(rad)*radius);
-        yp1 = y + (int8_t)(cos(rad)*radius);    
-        count++;
-
-        if (count != approx_segments)
+        if (ssd1309_OnArc(radius, start_angle, sweep, start_x - cx, start_y - cy))
         {
-            rad = ssd1309_DegToRad(count*approx_degree);
-        }
-        else
-        {            
-            rad = ssd1309_DegToRad(loc_sweep);
+            ssd1309_DrawPixelClipped(dev, start_x, start_y, color);
         }
 
-        xp2 = x + (int8_t)(sin(rad)*radius);
-        yp2 = y + (int8_t)(cos(rad)*radius);    
-        ssd1309_DrawLine(xp1, yp1, xp2, yp2, color);
+        if (both && ssd1309_OnArc(radius, start_angle, sweep, end_x - cx, end_y - cy))
+        {
+            ssd1309_DrawPixelClipped(dev, end_x, end_y, color);
+        }
+    }
+    else
+    {
+        /* Nothing to do */
     }
-    
-    // Radius line
-    ssd1309_DrawLine(x, y, first_point_x, first_point_y, color);
-    ssd1309_DrawLine(x, y, xp2, yp2, color);
 }
 
 
-/* Draw circle by Bresenhem's algorithm */
-void ssd1309_DrawCircle(uint8_t par_x, uint8_t par_y, uint8_t par_r, SSD1309_COLOR color)
+/* Draw filled pie from start_angle to end_angle, angles as in DrawArc */
+void ssd1309_FillPie(SSD1309_t *dev, uint8_t x, uint8_t y, uint8_t radius, uint16_t start_angle, uint16_t end_angle, SSD1309_COLOR color)
 {
-    int32_t x = -par_r;
+    ssd1309_FillSector(dev, x, y, radius, -1, start_angle, end_angle, color);
+}
+
+
+/* Draw filled ring thickness pixels wide inside radius, from start_angle to end_angle */
+void ssd1309_FillRing(SSD1309_t *dev, uint8_t x, uint8_t y, uint8_t radius, uint8_t thickness,
+                      uint16_t start_angle, uint16_t end_angle, SSD1309_COLOR color)
+{
+    int16_t inner = (thickness >= radius) ? -1 : (radius - thickness);
+
+    ssd1309_FillSector(dev, x, y, radius, inner, start_angle, end_angle, color);
+}
+
+
+/* Draw filled rectangle with corners rounded by radius r */
+void ssd1309_FillRoundRect(SSD1309_t *dev, uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t r, SSD1309_COLOR color)
+{
+    int16_t x_start = dev->OriginX + ((x1 <= x2) ? x1 : x2);
+    int16_t x_end   = dev->OriginX + ((x1 <= x2) ? x2 : x1);
+    int16_t y_start = dev->OriginY + ((y1 <= y2) ? y1 : y2);
+    int16_t y_end   = dev->OriginY + ((y1 <= y2) ? y2 : y1);
+    int32_t x;
     int32_t y = 0;
-    int32_t err = 2 - 2 * par_r;
+    int32_t err;
     int32_t e2;
+    int32_t last_y = 0;
 
-    if (par_x >= SSD1309_WIDTH || par_y >= SSD1309_HEIGHT)
+    /* The corners can take at most half of each side */
+    if (r > ((x_end - x_start) / 2))
     {
-        return;
+        r = (x_end - x_start) / 2;
     }
 
-    do {
-        ssd1309_DrawPixel(par_x - x, par_y + y, color);
-        ssd1309_DrawPixel(par_x + x, par_y + y, color);
-        ssd1309_DrawPixel(par_x + x, par_y - y, color);
-        ssd1309_DrawPixel(par_x - x, par_y - y, color);
+    if (r > ((y_end - y_start) / 2))
+    {
+        r = (y_end - y_start) / 2;
+    }
+
+    /* Rows between the corners are full width */
+    ssd1309_FillClipped(dev, x_start, y_start + r, x_end, y_end - r, color);
+
+    x   = -r;
+    err = 2 - 2 * r;
+
+    while (x <= 0)
+    {
+        /* Rows of the corners, the first point reached on a row is the widest */
+        if (y != last_y)
+        {
+            ssd1309_FillSpan(dev, x_start + r + x, x_end - r - x, y_start + r - y, color);
+            ssd1309_FillSpan(dev, x_start + r + x, x_end - r - x, y_end - r + y, color);
+            last_y = y;
+        }
+
         e2 = err;
 
         if (e2 <= y)
@@ -584,64 +3369,116 @@ void ssd1309_DrawCircle(uint8_t par_x, uint8_t par_y, uint8_t par_r, SSD1309_COL
         {
             /* Nothing to do */
         }
-    } while (x <= 0);
-
-    return;
+    }
 }
 
-/* Draw filled circle. Pixel positions calculated using Bresenham's algorithm */
-void ssd1309_FillCircle(uint8_t par_x,uint8_t par_y,uint8_t par_r, SSD1309_COLOR par_color)
+
+/* Walk the outline of the ellipse with radii rx, ry by Bresenham's algorithm, */
+/* drawing its points or one span per row                                      */
+static void ssd1309_Ellipse(SSD1309_t *dev, uint8_t par_x, uint8_t par_y, uint8_t rx, uint8_t ry,
+                            bool fill, SSD1309_COLOR color)
 {
-    int32_t x = -par_r;
+    int16_t cx = dev->OriginX + par_x;
+    int16_t cy = dev->OriginY + par_y;
+    int32_t x = -rx;
     int32_t y = 0;
-    int32_t err = 2 - 2 * par_r;
+    int32_t a2 = (int32_t)rx * rx;
+    int32_t b2 = (int32_t)ry * ry;
+    int32_t err = x * (2 * b2 + x) + b2;
     int32_t e2;
+    int32_t last_y = -1;
+    bool inside;
 
-    if (par_x >= SSD1306_WIDTH || par_y >= SSD1306_HEIGHT) {
+    /* Points are only checked against the clip when it cuts the ellipse */
+    if (!ssd1309_ClipTest(dev, cx - rx, cy - ry, cx + rx, cy + ry, &inside))
+    {
         return;
     }
 
     do {
-        for (uint8_t _y = (par_y + y); _y >= (par_y - y); _y--)
+        if (!fill)
         {
-            for (uint8_t _x = (par_x - x); _x >= (par_x + x); _x--)
+            /* Points on the axes are drawn once, Inverse would undo them */
+            ssd1309_PlotPoint(dev, cx - x, cy + y, inside, color);
+
+            if (x != 0)
             {
-                ssd1309_DrawPixel(_x, _y, par_color);
+                ssd1309_PlotPoint(dev, cx + x, cy + y, inside, color);
             }
-        }
 
-        e2 = err;
-        if (e2 <= y)
-        {
-            y++;
-            err = err + (y * 2 + 1);
-            if (-x == y && e2 <= x) {
-                e2 = 0;
+            if ((x != 0) && (y != 0))
+            {
+                ssd1309_PlotPoint(dev, cx + x, cy - y, inside, color);
+            }
+
+            if (y != 0)
+            {
+                ssd1309_PlotPoint(dev, cx - x, cy - y, inside, color);
             }
-            else {
-                /* nothing to do */
+        }
+        else if (y != last_y)
+        {
+            /* The first point reached on a row is the widest */
+            ssd1309_FillSpan(dev, cx + x, cx - x, cy + y, color);
+
+            if (y != 0)
+            {
+                ssd1309_FillSpan(dev, cx + x, cx - x, cy - y, color);
             }
+
+            last_y = y;
+        }
+        else { /* Nothing to do */ }
+
+        e2 = 2 * err;
+
+        if (e2 >= ((x * 2 + 1) * b2))
+        {
+            x++;
+            err += (x * 2 + 1) * b2;
         }
         else
         {
-            /* nothing to do */
+            /* Nothing to do */
         }
 
-        if (e2 > x)
+        if (e2 <= ((y * 2 + 1) * a2))
         {
-            x++;
-            err = err + (x * 2 + 1);
+            y++;
+            err += (y * 2 + 1) * a2;
         }
         else
         {
-            /* nothing to do */
+            /* Nothing to do */
         }
     } while (x <= 0);
+
+    /* Flat ellipses stop early, finish the tips */
+    while (y < ry)
+    {
+        y++;
+        ssd1309_PlotPoint(dev, cx, cy + y, inside, color);
+        ssd1309_PlotPoint(dev, cx, cy - y, inside, color);
+    }
+}
+
+
+/* Draw ellipse */
+void ssd1309_DrawEllipse(SSD1309_t *dev, uint8_t par_x, uint8_t par_y, uint8_t rx, uint8_t ry, SSD1309_COLOR color)
+{
+    ssd1309_Ellipse(dev, par_x, par_y, rx, ry, false, color);
+}
+
+
+/* Draw filled ellipse */
+void ssd1309_FillEllipse(SSD1309_t *dev, uint8_t par_x, uint8_t par_y, uint8_t rx, uint8_t ry, SSD1309_COLOR color)
+{
+    ssd1309_Ellipse(dev, par_x, par_y, rx, ry, true, color);
 }
 
 
 /* Draw polyline */
-void ssd1309_Polyline(const SSD1309_VERTEX *par_vertex, uint16_t par_size, SSD1309_COLOR color)
+void ssd1309_Polyline(SSD1309_t *dev, const SSD1309_VERTEX *par_vertex, uint16_t par_size, SSD1309_COLOR color)
 {
     uint16_t i;
 
@@ -649,7 +3486,18 @@ void ssd1309_Polyline(const SSD1309_VERTEX *par_vertex, uint16_t par_size, SSD13
     {
         for (i = 1; i < par_size; i++)
         {
-            ssd1309_DrawLine(par_vertex[i - 1].x, par_vertex[i - 1].y, par_vertex[i].x, par_vertex[i].y, color);
+            ssd1309_DrawLine(dev, par_vertex[i - 1].x, par_vertex[i - 1].y, par_vertex[i].x, par_vertex[i].y, color);
+        }
+
+        /* Inverse went over every joint with both of its lines, invert it once more, */
+        /* the last vertex is a joint too when it closes the polyline                */
+        for (i = 1; (color == Inverse) && (i < par_size); i++)
+        {
+            if (((i + 1) < par_size) ||
+                ((i > 2) && (par_vertex[i].x == par_vertex[0].x) && (par_vertex[i].y == par_vertex[0].y)))
+            {
+                ssd1309_DrawPixel(dev, par_vertex[i].x, par_vertex[i].y, color);
+            }
         }
     }
     else
@@ -660,93 +3508,461 @@ void ssd1309_Polyline(const SSD1309_VERTEX *par_vertex, uint16_t par_size, SSD13
 }
 
 
-/* Draw rectangle */
-void ssd1309_DrawRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1309_COLOR color)
+/* Draw rectangle, the sides meet without overlap so Inverse covers each pixel once */
+void ssd1309_DrawRectangle(SSD1309_t *dev, uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1309_COLOR color)
 {
-    ssd1309_DrawLine(x1, y1, x2, y1, color);
-    ssd1309_DrawLine(x2, y1, x2, y2, color);
-    ssd1309_DrawLine(x2, y2, x1, y2, color);
-    ssd1309_DrawLine(x1, y2, x1, y1, color);
+    uint8_t y_start = ((y1 <= y2) ? y1 : y2);
+    uint8_t y_end   = ((y1 <= y2) ? y2 : y1);
+
+    ssd1309_DrawHLine(dev, x1, x2, y_start, color);
+
+    if (y_end != y_start)
+    {
+        ssd1309_DrawHLine(dev, x1, x2, y_end, color);
+    }
+
+    if ((y_end - y_start) > 1)
+    {
+        ssd1309_DrawVLine(dev, x1, y_start + 1, y_end - 1, color);
+
+        if (x2 != x1)
+        {
+            ssd1309_DrawVLine(dev, x2, y_start + 1, y_end - 1, color);
+        }
+    }
 }
 
 
 /* Draw filled rectangle */
-void ssd1309_FillRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1309_COLOR color)
+void ssd1309_FillRectangle(SSD1309_t *dev, uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1309_COLOR color)
 {
     uint8_t x_start = ((x1 <= x2) ? x1 : x2);
     uint8_t x_end   = ((x1 <= x2) ? x2 : x1);
     uint8_t y_start = ((y1 <= y2) ? y1 : y2);
     uint8_t y_end   = ((y1 <= y2) ? y2 : y1);
 
-    for (uint8_t y = y_start; (y <= y_end) && (y < SSD1309_HEIGHT); y++) {
-        for (uint8_t x = x_start; (x <= x_end) && (x < SSD1309_WIDTH); x++) {
-            ssd1309_DrawPixel(x, y, color);
-        }
-    }
-    return;
+    ssd1309_FillClipped(dev, dev->OriginX + x_start, dev->OriginY + y_start, dev->OriginX + x_end,
+                        dev->OriginY + y_end, color);
 }
 
 
-/* Draw bitmap - ported from the ADAFruit GFX library */
-void ssd1309_DrawBitmap(uint8_t x, uint8_t y, const unsigned char* bitmap, uint8_t w, uint8_t h, SSD1309_COLOR color)
+/* Draw bitmap - ported from the ADAFruit GFX library, the rows and columns */
+/* inside the clip only                                                    */
+void ssd1309_DrawBitmap(SSD1309_t *dev, uint8_t x, uint8_t y, const unsigned char* bitmap, uint8_t w, uint8_t h, SSD1309_COLOR color)
 {
-    uint8_t byte = 0;
     int16_t byteWidth = (w + 7) / 8; /* Bitmap scanline pad = whole byte */
-
-    if (x >= SSD1309_WIDTH || y >= SSD1309_HEIGHT)
+    int16_t left      = dev->OriginX + x;
+    int16_t top       = dev->OriginY + y;
+    int16_t x1        = left;
+    int16_t y1        = top;
+    int16_t x2        = left + w - 1;
+    int16_t y2        = top + h - 1;
+
+    if ((w == 0) || (h == 0) || !ssd1309_ClipBox(dev, &x1, &y1, &x2, &y2))
     {
         return;
     }
 
-    for (uint8_t j = 0; j < h; j++, y++)
+    for (int16_t j = y1; j <= y2; j++)
     {
-        for (uint8_t i = 0; i < w; i++)
+        const unsigned char *row = &bitmap[(j - top) * byteWidth];
+        uint8_t byte             = row[(x1 - left) / 8] << ((x1 - left) & 7);
+
+        for (int16_t i = x1; i <= x2; i++)
         {
-            if (i & 7)
+            if ((i != x1) && (((i - left) & 7) == 0))
             {
-                byte <<= 1;
+                byte = row[(i - left) / 8];
             }
-            else
+
+            if (byte & 0x80)
             {
-                byte = (*(const unsigned char *)(&bitmap[j * byteWidth + i / 8]));
+                ssd1309_PlotPixel(dev, i, j, color);
             }
 
-            if (byte & 0x80)
+            byte <<= 1;
+        }
+    }
+}
+
+
+/* Column byte of a page-major bitmap moved down by shift rows: its low part from band, */
+/* its high part from the band above, either NULL outside the bitmap                    */
+static inline uint8_t ssd1309_ShiftedByte(const uint8_t *band, const uint8_t *above, uint8_t column, uint8_t shift)
+{
+    uint8_t byte = (NULL != band) ? (uint8_t)(band[column] << shift) : 0;
+
+    if ((NULL != above) && (shift != 0))
+    {
+        byte |= above[column] >> (8 - shift);
+    }
+
+    return byte;
+}
+
+
+/* Portrait DrawPageBitmap, x and y on the screen: the bands need no shifting, */
+/* their columns are gathered into blocks and written as screenbuffer rows   */
+static void ssd1309_DrawPageBitmapPortrait(SSD1309_t *dev, int16_t x, int16_t y, const SSD1309_Bitmap_t *bitmap,
+                                           int16_t x1, int16_t y1, int16_t x2, int16_t y2, SSD1309_ROP rop)
+{
+    SSD1309_BLOCK block = {0, 0, 0, -1, 0};
+    uint8_t columns     = x2 - x1 + 1;
+    uint8_t bands       = (bitmap->Height + 7) / 8;
+
+    for (uint8_t band = (y1 - y) / 8; (band < bands) && ((y + band * 8) <= y2); band++)
+    {
+        int16_t top         = y + band * 8;
+        uint8_t rows        = ssd1309_RowsMask(top, y1, y2);
+        const uint8_t *data = &bitmap->Data[band * bitmap->Width + (x1 - x)];
+        const uint8_t *mask = (NULL != bitmap->Mask) ? &bitmap->Mask[band * bitmap->Width + (x1 - x)] : data;
+
+        switch (rop)
+        {
+            case SSD1309_ROP_COPY:
+                for (uint8_t i = 0; i < columns; i++)
+                {
+                    ssd1309_PutBlock(dev, &block, x1 + i, top, data[i] & rows, ~data[i] & rows, 0);
+                }
+                break;
+
+            case SSD1309_ROP_OR:
+                for (uint8_t i = 0; i < columns; i++)
+                {
+                    ssd1309_PutBlock(dev, &block, x1 + i, top, data[i] & rows, 0, 0);
+                }
+                break;
+
+            case SSD1309_ROP_AND:
+                for (uint8_t i = 0; i < columns; i++)
+                {
+                    ssd1309_PutBlock(dev, &block, x1 + i, top, 0, ~data[i] & rows, 0);
+                }
+                break;
+
+            case SSD1309_ROP_XOR:
+                for (uint8_t i = 0; i < columns; i++)
+                {
+                    ssd1309_PutBlock(dev, &block, x1 + i, top, 0, 0, data[i] & rows);
+                }
+                break;
+
+            case SSD1309_ROP_CLEAR:
+                for (uint8_t i = 0; i < columns; i++)
+                {
+                    ssd1309_PutBlock(dev, &block, x1 + i, top, 0, data[i] & rows, 0);
+                }
+                break;
+
+            case SSD1309_ROP_MASKED:
+                for (uint8_t i = 0; i < columns; i++)
+                {
+                    uint8_t bits = mask[i] & rows;
+
+                    ssd1309_PutBlock(dev, &block, x1 + i, top, data[i] & bits, ~data[i] & bits, 0);
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    ssd1309_FlushBlock(dev, &block);
+}
+
+
+/* Draw a page-major bitmap with a raster operation, a byte per column and page */
+void ssd1309_DrawPageBitmap(SSD1309_t *dev, uint8_t x, uint8_t y, const SSD1309_Bitmap_t *bitmap, SSD1309_ROP rop)
+{
+    int16_t left  = dev->OriginX + x;
+    int16_t top   = dev->OriginY + y;
+    int16_t x1    = left;
+    int16_t y1    = top;
+    int16_t x2    = left + bitmap->Width - 1;
+    int16_t y2    = top + bitmap->Height - 1;
+    int16_t base  = (top >= 0) ? (top / 8) : -((7 - top) / 8);
+    uint8_t shift = top - base * 8;
+    uint8_t bands = (bitmap->Height + 7) / 8;
+    uint8_t first;
+    uint8_t columns;
+
+    if ((bitmap->Width == 0) || (bitmap->Height == 0) || !ssd1309_ClipBox(dev, &x1, &y1, &x2, &y2))
+    {
+        return;
+    }
+
+    columns = x2 - x1 + 1;
+    first   = x1 - left;
+
+    ssd1309_MarkArea(dev, x1, y1, x2, y2);
+    SSD1309_STATS_ADD(dev, Pixels, (uint32_t)columns * (y2 - y1 + 1));
+
+    if (SSD1309_PORTRAIT(dev))
+    {
+        ssd1309_DrawPageBitmapPortrait(dev, left, top, bitmap, x1, y1, x2, y2, rop);
+        return;
+    }
+
+    for (int16_t page = y1 / 8; page <= (y2 / 8); page++)
+    {
+        /* Band page - base moved down by shift, the one above supplies the top rows; */
+        /* both start at the first column inside the clip                            */
+        int16_t index          = page - base;
+        const uint8_t *band    = (index < bands) ? &bitmap->Data[index * bitmap->Width + first] : NULL;
+        const uint8_t *above   = (index > 0) ? &bitmap->Data[(index - 1) * bitmap->Width + first] : NULL;
+        const uint8_t *mask_lo = NULL;
+        const uint8_t *mask_hi = NULL;
+        uint8_t *pixel         = &dev->Buffer[dev->Width * page + x1];
+        uint8_t rows           = ssd1309_RowsMask(page * 8, y1, y2);
+
+        SSD1309_TRACE_BYTES(dev, pixel - dev->Buffer, columns);
+
+        switch (rop)
+        {
+            case SSD1309_ROP_COPY:
+                if ((rows == 0xFF) && (shift == 0))
+                {
+                    memcpy(pixel, band, columns);
+                    break;
+                }
+
+                for (uint8_t i = 0; i < columns; i++)
+                {
+                    pixel[i] = (pixel[i] & ~rows) | (ssd1309_ShiftedByte(band, above, i, shift) & rows);
+                }
+                break;
+
+            case SSD1309_ROP_OR:
+                for (uint8_t i = 0; i < columns; i++)
+                {
+                    pixel[i] |= ssd1309_ShiftedByte(band, above, i, shift) & rows;
+                }
+                break;
+
+            case SSD1309_ROP_AND:
+                for (uint8_t i = 0; i < columns; i++)
+                {
+                    pixel[i] &= ssd1309_ShiftedByte(band, above, i, shift) | ~rows;
+                }
+                break;
+
+            case SSD1309_ROP_XOR:
+                for (uint8_t i = 0; i < columns; i++)
+                {
+                    pixel[i] ^= ssd1309_ShiftedByte(band, above, i, shift) & rows;
+                }
+                break;
+
+            case SSD1309_ROP_CLEAR:
+                for (uint8_t i = 0; i < columns; i++)
+                {
+                    pixel[i] &= ~(ssd1309_ShiftedByte(band, above, i, shift) & rows);
+                }
+                break;
+
+            case SSD1309_ROP_MASKED:
+                if (NULL != bitmap->Mask)
+                {
+                    mask_lo = (index < bands) ? &bitmap->Mask[index * bitmap->Width + first] : NULL;
+                    mask_hi = (index > 0) ? &bitmap->Mask[(index - 1) * bitmap->Width + first] : NULL;
+                }
+                else
+                {
+                    mask_lo = band;
+                    mask_hi = above;
+                }
+
+                for (uint8_t i = 0; i < columns; i++)
+                {
+                    uint8_t mask = ssd1309_ShiftedByte(mask_lo, mask_hi, i, shift) & rows;
+
+                    pixel[i] = (pixel[i] & ~mask) | (ssd1309_ShiftedByte(band, above, i, shift) & mask);
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+
+/* Stream a run-length coded image from flash to columns x.., pages page.. of the panel, */
+/* decoded into the flush scratch buffer one transport-sized chunk at a time           */
+SSD1309_Error_t ssd1309_StreamImage(SSD1309_t *dev, uint8_t x, uint8_t page, const SSD1309_Image_t *image)
+{
+    SSD1309_RLE rle    = {image->Data, 0, 0, false};
+    uint8_t bands      = (image->Height + 7) / 8;
+    uint32_t remaining = (uint32_t)image->Width * bands;
+    uint8_t *chunk     = &dev->FlushScratch[SSD1309_HEADROOM];
+    uint8_t column     = 0;
+    uint8_t row        = page;
+    uint8_t commands[8];
+    uint8_t count = 0;
+
+    if (dev->Busy || dev->Scrolling)
+    {
+        return SSD1309_BUSY;
+    }
+
+    if ((image->Width == 0) || (bands == 0) || (x < SSD1309_VISIBLE_X_MIN(dev)) ||
+        ((x + image->Width - 1) > SSD1309_VISIBLE_X_MAX(dev)) || ((page + bands) > dev->Pages))
+    {
+        return SSD1309_ERR;
+    }
+
+    if (dev->Addressing != SSD1309_ADDRESSING_HORIZONTAL)
+    {
+        commands[count++] = 0x20;
+        commands[count++] = SSD1309_ADDRESSING_HORIZONTAL;
+        dev->Addressing   = SSD1309_ADDRESSING_HORIZONTAL;
+    }
+
+    commands[count++] = 0x21; /* Set column address */
+    commands[count++] = x + dev->OffsetX;
+    commands[count++] = x + image->Width - 1 + dev->OffsetX;
+    commands[count++] = 0x22; /* Set page address */
+    commands[count++] = page;
+    commands[count++] = page + bands - 1;
+
+    ssd1309_WriteCommands(dev, commands, count);
+
+    while (remaining > 0)
+    {
+        uint16_t size = (remaining > SSD1309_STREAM_CHUNK_SIZE) ? SSD1309_STREAM_CHUNK_SIZE : remaining;
+
+        for (uint16_t i = 0; i < size; i++)
+        {
+            chunk[i] = ssd1309_RleNext(&rle);
+
+            /* The display RAM keeps the image, the screenbuffer is left alone */
+            if (NULL != dev->Shadow)
+            {
+                dev->Shadow[dev->Width * row + x + column] = chunk[i];
+            }
+
+            if (++column == image->Width)
             {
-                ssd1309_DrawPixel(x + i, y, color);
+                column = 0;
+                row++;
             }
         }
+
+        ssd1309_Transmit(dev, OLED_WRITE_DATA, chunk, size, false);
+        ssd1309_TransmitDone(dev);
+
+        remaining -= size;
     }
 
-    return;
+    return SSD1309_OK;
 }
 
 
-void ssd1309_SetContrast(const uint8_t value)
+void ssd1309_SetContrast(SSD1309_t *dev, const uint8_t value)
 {
     const uint8_t kSetContrastControlRegister = 0x81;
+    const uint8_t commands[] = {kSetContrastControlRegister, value};
+
+    ssd1309_WriteCommands(dev, commands, sizeof(commands));
+}
+
+
+/* Rotate the screen, 180 degrees by the panel, 90 and 270 in the screenbuffer */
+SSD1309_Error_t ssd1309_SetRotation(SSD1309_t *dev, SSD1309_ROTATION rotation)
+{
+    bool flip = (rotation == ROTATION_180) || (rotation == ROTATION_270);
+    uint8_t commands[2];
+
+    if (rotation > ROTATION_270)
+    {
+        return SSD1309_ERR;
+    }
+
+    if (dev->Busy)
+    {
+        return SSD1309_BUSY;
+    }
+
+    commands[0] = flip ? (SSD1309_SEGMENT_REMAP ^ 0x01) : SSD1309_SEGMENT_REMAP;
+    commands[1] = flip ? (SSD1309_COM_SCAN ^ 0x08) : SSD1309_COM_SCAN;
+
+    ssd1309_WriteCommands(dev, commands, sizeof(commands));
+
+    /* The segment remap only maps data written after it: the picture in the */
+    /* display RAM stays mirrored until it is sent again                      */
+    if (flip != ((dev->Rotation == ROTATION_180) || (dev->Rotation == ROTATION_270)))
+    {
+        ssd1309_Invalidate(dev);
+    }
+
+    dev->Rotation = rotation;
+
+    /* The clip of the old screen may not fit the new one */
+    ssd1309_ResetView(dev);
+
+    return SSD1309_OK;
+}
+
+
+/* Save the view and narrow the clip to rect, given relative to the origin */
+SSD1309_Error_t ssd1309_PushClip(SSD1309_t *dev, const SSD1309_RECT *rect)
+{
+    int16_t x1 = dev->OriginX + rect->x1;
+    int16_t y1 = dev->OriginY + rect->y1;
+    int16_t x2 = dev->OriginX + rect->x2;
+    int16_t y2 = dev->OriginY + rect->y2;
+
+    if (dev->ClipDepth >= SSD1309_CLIP_DEPTH)
+    {
+        return SSD1309_ERR;
+    }
+
+    dev->ClipStack[dev->ClipDepth].Clip    = dev->Clip;
+    dev->ClipStack[dev->ClipDepth].OriginX = dev->OriginX;
+    dev->ClipStack[dev->ClipDepth].OriginY = dev->OriginY;
+    dev->ClipDepth++;
+
+    if (ssd1309_ClipBox(dev, &x1, &y1, &x2, &y2))
+    {
+        dev->Clip.x1 = x1;
+        dev->Clip.y1 = y1;
+        dev->Clip.x2 = x2;
+        dev->Clip.y2 = y2;
+    }
+    else
+    {
+        /* Nothing is drawn until the pop */
+        dev->Clip.x1 = 1;
+        dev->Clip.y1 = 1;
+        dev->Clip.x2 = 0;
+        dev->Clip.y2 = 0;
+    }
 
-    ssd1309_WriteCommand(kSetContrastControlRegister);
-    ssd1309_WriteCommand(value);
+    return SSD1309_OK;
 }
 
 
-/* Convert Degrees to Radians */
-static float ssd1309_DegToRad(float par_deg) {
-    return par_deg * 3.14 / 180.0;
+/* Restore the view saved by the last PushClip */
+SSD1309_Error_t ssd1309_PopClip(SSD1309_t *dev)
+{
+    if (dev->ClipDepth == 0)
+    {
+        return SSD1309_ERR;
+    }
+
+    dev->ClipDepth--;
+    dev->Clip    = dev->ClipStack[dev->ClipDepth].Clip;
+    dev->OriginX = dev->ClipStack[dev->ClipDepth].OriginX;
+    dev->OriginY = dev->ClipStack[dev->ClipDepth].OriginY;
+
+    return SSD1309_OK;
 }
 
-/* Normalize degree to [0; 360] */
-static uint16_t ssd1309_NormalizeTo0_360(uint16_t par_deg) {
-  uint16_t loc_angle;
-  if(par_deg <= 360)
-  {
-    loc_angle = par_deg;
-  }
-  else
-  {
-    loc_angle = par_deg % 360;
-    loc_angle = ((par_deg != 0)?par_deg:360);
-  }
-  return loc_angle;
-}
\ No newline at end of file
+
+/* Move the origin of the drawing coordinates to x, y of the screen */
+void ssd1309_SetOrigin(SSD1309_t *dev, int16_t x, int16_t y)
+{
+    dev->OriginX = x;
+    dev->OriginY = y;
+}
@@ -10,7 +10,6 @@
 #ifndef __SSD1309_H__
 #define __SSD1309_H__
 
-#include <math.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
@@ -33,44 +32,103 @@
 #define SSD1309_I2C_ADDR        0x3C
 #endif
 
+/* Largest I2C write the transport accepts, control byte */
+/* included (255 for nrf_drv_twi / TWIM on nRF52832)     */
+#ifndef SSD1309_I2C_MAX_TRANSFER
+#define SSD1309_I2C_MAX_TRANSFER    255
+#endif
+
+/* Control byte in front of every I2C write              */
+#define SSD1309_I2C_CONTROL_COMMAND 0x00
+#define SSD1309_I2C_CONTROL_DATA    0x40
+
+/* Bytes copied per write by the public Write* functions, */
+/* screen updates are sent without copying               */
 #define MAX_TX_DATA             64
-#define MAX_ADDRESS_SIZE        2
+#define MAX_CONTROL_SIZE        1
 
-#define MAX_TX_SIZE             (MAX_TX_DATA + MAX_ADDRESS_SIZE)
-typedef void (*ssd1309_i2c_handle)(uint8_t, uint8_t *, size);
+#define MAX_TX_SIZE             (MAX_TX_DATA + MAX_CONTROL_SIZE)
+
+/* Spare byte in front of every screenbuffer, where the   */
+/* control byte of an I2C write goes                      */
+#define SSD1309_HEADROOM        MAX_CONTROL_SIZE
+typedef void (*ssd1309_i2c_handle)(uint8_t, uint8_t *, size_t);
 #elif defined(SSD1309_USE_SPI)
+#define SSD1309_HEADROOM        0
 typedef void (*ssd1309_spi_handle)(uint8_t, uint8_t *, size_t);
 #else
 #error "You should define SSD1309_USE_SPI or SSD1309_USE_I2C macro!"
 #endif
 
-/* SSD1309 OLED height in pixels  */
+/* Default SSD1309 OLED height in pixels */
 #ifndef SSD1309_HEIGHT
 #define SSD1309_HEIGHT          64
 #endif
 
-/* SSD1309 width in pixels	  */
+/* Default SSD1309 width in pixels	  */
 #ifndef SSD1309_WIDTH
 #define SSD1309_WIDTH           130
 #endif
 
-/* SSD1309 offset of x in pixels  */
+/* Default SSD1309 offset of x in pixels: screenbuffer  */
+/* column x is sent to controller column (x + offset)  */
 #ifndef SSD1309_OFFSET_X
-#define SSD1309_OFFSET_X        -2
-#define SSD1309_X_OFFSET_LOWER (SSD1309_X_OFFSET & 0x0F)
-#define SSD1309_X_OFFSET_UPPER ((SSD1309_X_OFFSET >> 4) & 0x07)
-#else
-#define SSD1309_X_OFFSET_LOWER 0
-#define SSD1309_X_OFFSET_UPPER 0
+#define SSD1309_OFFSET_X        (-2)
 #endif
 
-/* SSD1309 offset of y in pixels  */
+/* Default SSD1309 offset of y in pixels */
 #ifndef SSD1309_OFFSET_Y
 #define SSD1309_OFFSET_Y        0
 #endif
 
+/* Number of columns in the controller's display RAM */
+#define SSD1309_COLUMNS         128
+
+#define SSD1309_PAGES           (SSD1309_HEIGHT / 8)
 #define SSD1309_BUFFER_SIZE     (SSD1309_WIDTH * SSD1309_HEIGHT / 8)
 
+/* Pages of the tallest display driven by the firmware,   */
+/* sizes the per-device update state                      */
+#ifndef SSD1309_MAX_PAGES
+#define SSD1309_MAX_PAGES       SSD1309_PAGES
+#endif
+
+/* Bytes to reserve for the screenbuffer of a display     */
+#define SSD1309_BUFFER_BYTES(width, height) (SSD1309_HEADROOM + (width) * ((height) / 8))
+
+/* Overhead of one bus transaction (DC toggle, CS, driver */
+/* call) expressed in data byte times, used to pick the   */
+/* cheapest addressing mode for an update                 */
+#ifndef SSD1309_TRANSACTION_COST
+#define SSD1309_TRANSACTION_COST    8
+#endif
+
+/* Size of the buffer used to reorder window updates, one */
+/* gathered data transaction at most                      */
+#ifndef SSD1309_FLUSH_SCRATCH_SIZE
+#define SSD1309_FLUSH_SCRATCH_SIZE  128
+#endif
+
+/* Runs of changed bytes sent per page when diffing      */
+/* against a shadow, the last run takes the rest of page  */
+#ifndef SSD1309_MAX_RUNS
+#define SSD1309_MAX_RUNS        4
+#endif
+
+/* Largest number of bus transfers and command bytes of one update */
+#define SSD1309_MAX_TRANSFERS   ((2 * SSD1309_MAX_RUNS + 2) * SSD1309_MAX_PAGES + 8)
+#define SSD1309_MAX_COMMANDS    (3 * SSD1309_MAX_RUNS * SSD1309_MAX_PAGES + 8)
+
+/* Nesting depth of ssd1309_PushClip */
+#ifndef SSD1309_CLIP_DEPTH
+#define SSD1309_CLIP_DEPTH      4
+#endif
+
+/* Buckets of the update duration histogram of ssd1309_GetStats() */
+#ifndef SSD1309_STATS_BUCKETS
+#define SSD1309_STATS_BUCKETS   32
+#endif
+
 #define OLED_RESET              0
 #define OLED_WRITE_DATA         1
 #define OLED_WRITE_COMMAND      2
@@ -82,16 +140,82 @@ typedef void (*ssd1309_spi_handle)(uint8_t, uint8_t *, size_t);
 /* Enumeration for screen colors			  */
 typedef enum 
 {
-    Black = 0x00, /* Black color, no pixel		  */
-    White = 0x01  /* Pixel is set. Color depends on OLED  */
+    Black   = 0x00, /* Black color, no pixel		  */
+    White   = 0x01, /* Pixel is set. Color depends on OLED  */
+    Inverse = 0x02  /* Pixel is inverted, drawing the same  */
+                    /* shape again restores the screen.     */
+                    /* Text leaves its background as is     */
 } SSD1309_COLOR;
 
 typedef enum
 {
     SSD1309_OK  = 0x00,
-    SSD1309_ERR = 0x01  /* Generic error                  */
+    SSD1309_ERR = 0x01, /* Generic error                  */
+    SSD1309_BUSY = 0x02 /* Previous update still on the bus */
 } SSD1309_Error_t;
 
+/* Called when an asynchronous update has left the bus */
+typedef void (*ssd1309_done_handle)(void);
+
+/* Free running clock used to time updates, any unit */
+typedef uint32_t (*ssd1309_timestamp_handle)(void);
+
+/* Bus usage of the last update */
+typedef struct
+{
+    uint32_t Bytes;         /* Bytes handed to the transport, I2C control bytes included */
+    uint32_t Transactions;  /* Transport calls (I2C: start/address/stop each)           */
+    uint32_t Ticks;         /* Duration measured with the timestamp handle              */
+} SSD1309_Throughput_t;
+
+#if defined(SSD1309_ENABLE_STATS)
+/* Bus and drawing counters since init or the last ssd1309_ResetStats() */
+typedef struct
+{
+    uint32_t CommandBytes;
+    uint32_t DataBytes;
+    uint32_t Transactions;      /* Transport calls                              */
+    uint32_t Flushes;           /* Updates that sent changes                    */
+    uint32_t SkippedFlushes;    /* Updates with nothing to send                 */
+    uint32_t Pixels;            /* Pixels drawn into the screenbuffer           */
+    uint32_t Duration[SSD1309_STATS_BUCKETS]; /* Updates taking 0, 1, 2-3, 4-7... */
+                                /* timestamp ticks, the last bucket takes the rest */
+} SSD1309_Stats_t;
+#endif
+
+/* Memory addressing modes used to flush the screenbuffer */
+typedef enum
+{
+    SSD1309_ADDRESSING_HORIZONTAL = 0x00,
+    SSD1309_ADDRESSING_VERTICAL   = 0x01,
+    SSD1309_ADDRESSING_PAGE       = 0x02,
+    SSD1309_ADDRESSING_AUTO       = 0xFF  /* Cheapest mode per update */
+} SSD1309_ADDRESSING;
+
+/* Hardware scrolling, the panel moves the picture by itself */
+typedef enum
+{
+    SSD1309_SCROLL_RIGHT          = 0x00,
+    SSD1309_SCROLL_LEFT           = 0x01,
+    SSD1309_SCROLL_VERTICAL_RIGHT = 0x02, /* Diagonal: right and up by the vertical offset */
+    SSD1309_SCROLL_VERTICAL_LEFT  = 0x03, /* Diagonal: left and up by the vertical offset  */
+    SSD1309_SCROLL_VERTICAL       = 0x04  /* Up by the vertical offset only                */
+} SSD1309_SCROLL;
+
+/* Frames between two scroll steps, as coded in the scroll commands */
+typedef enum
+{
+    SSD1309_SCROLL_2_FRAMES   = 0x07,
+    SSD1309_SCROLL_3_FRAMES   = 0x04,
+    SSD1309_SCROLL_4_FRAMES   = 0x05,
+    SSD1309_SCROLL_5_FRAMES   = 0x00,
+    SSD1309_SCROLL_25_FRAMES  = 0x06,
+    SSD1309_SCROLL_64_FRAMES  = 0x01,
+    SSD1309_SCROLL_128_FRAMES = 0x02,
+    SSD1309_SCROLL_256_FRAMES = 0x03
+} SSD1309_SCROLL_INTERVAL;
+
+/* Clockwise rotation of the screen, see ssd1309_SetRotation */
 typedef enum
 {
     ROTATION_0    = 0,
@@ -100,14 +224,152 @@ typedef enum
     ROTATION_270  = 3
 } SSD1309_ROTATION;
 
-/* Struct to store transformations			  */
+/* Rectangle, both corners included */
+typedef struct
+{
+    uint8_t x1;
+    uint8_t y1;
+    uint8_t x2;
+    uint8_t y2;
+} SSD1309_RECT;
+
+/* Clip rectangle and origin saved by ssd1309_PushClip */
+typedef struct
+{
+    SSD1309_RECT Clip;
+    int16_t OriginX;
+    int16_t OriginY;
+} SSD1309_VIEW;
+
+/* Bounding box of the dirty spans of one update */
+typedef struct
+{
+    uint8_t PageStart;
+    uint8_t PageEnd;
+    uint8_t XStart;
+    uint8_t XEnd;
+    uint8_t Pages;      /* Number of dirty pages            */
+    uint16_t Runs;      /* Number of runs to send in page mode */
+    uint16_t Bytes;     /* Sum of the runs in bytes         */
+} SSD1309_REGION;
+
+/* One command or data transfer of an update */
+typedef struct
+{
+    uint8_t Type;       /* OLED_WRITE_COMMAND or OLED_WRITE_DATA                */
+    uint16_t Size;
+    uint8_t *Data;      /* NULL: next chunk of the gathered region              */
+} SSD1309_TRANSFER;
+
+/* Geometry, memory and transport of one display */
+typedef struct
+{
+    uint8_t Width;              /* In pixels, up to 255                        */
+    uint8_t Height;             /* 32, 64 or 128, at most SSD1309_MAX_PAGES * 8 */
+    int8_t OffsetX;
+    int8_t OffsetY;
+    uint8_t *Buffer;            /* SSD1309_BUFFER_BYTES(Width, Height) bytes    */
+    uint8_t *BackBuffer;        /* Same size, optional: enables double buffering */
+    uint8_t *Shadow;            /* Width * Height / 8 bytes, optional: copy of the */
+                                /* display RAM, only changed bytes are sent      */
+#if defined(SSD1309_USE_I2C)
+    ssd1309_i2c_handle CommHandle;
+    uint8_t Address;
+#elif defined(SSD1309_USE_SPI)
+    ssd1309_spi_handle CommHandle;
+#endif
+} SSD1309_Config_t;
+
+/* State of one display, owned by the application	  */
 typedef struct 
 {
     uint16_t CurrentX;
     uint16_t CurrentY;
     SSD1309_ROTATION Rotation;
+    SSD1309_ADDRESSING FlushMode;   /* Mode requested for updates      */
+    SSD1309_ADDRESSING Addressing;  /* Mode currently set in the panel */
     uint8_t Initialized;
     uint8_t DisplayOn;
+
+    /* Display start line, sent with the next update */
+    uint8_t StartLine;
+    bool StartLinePending;
+
+    /* Drawing is clipped to Clip (rotated screen, empty when x1 > x2), */
+    /* coordinates are relative to the origin; the stack holds the     */
+    /* views saved by ssd1309_PushClip                                  */
+    SSD1309_RECT Clip;
+    int16_t OriginX;
+    int16_t OriginY;
+    SSD1309_VIEW ClipStack[SSD1309_CLIP_DEPTH];
+    uint8_t ClipDepth;
+
+    /* Pages moved by the running hardware scroll */
+    bool Scrolling;
+    uint8_t ScrollStartPage;
+    uint8_t ScrollEndPage;
+
+    /* Geometry */
+    uint8_t Width;
+    uint8_t Height;
+    uint8_t Pages;
+    int8_t OffsetX;
+    int8_t OffsetY;
+
+    /* Drawing goes to Buffer, FrontBuffer (double buffering */
+    /* only) holds the last frame sent                       */
+    uint8_t *Buffer;
+    uint8_t *FrontBuffer;
+
+    /* What the display RAM holds (optional), valid once a */
+    /* full frame went out after ssd1309_Invalidate()      */
+    uint8_t *Shadow;
+    bool ShadowValid;
+
+    /* Dirty column span of every page since the last update, */
+    /* a page is clean when its min is above its max           */
+    uint8_t DirtyMin[SSD1309_MAX_PAGES];
+    uint8_t DirtyMax[SSD1309_MAX_PAGES];
+
+    /* Transport */
+#if defined(SSD1309_USE_I2C)
+    ssd1309_i2c_handle CommHandle;
+    ssd1309_i2c_handle AsyncHandle;
+    uint8_t Address;
+    uint8_t *ControlPosition;   /* The control byte on the bus replaced this byte */
+    uint8_t ControlSaved;
+#elif defined(SSD1309_USE_SPI)
+    ssd1309_spi_handle CommHandle;
+    ssd1309_spi_handle AsyncHandle;
+#endif
+
+    /* Update queued for the bus */
+    SSD1309_TRANSFER Transfers[SSD1309_MAX_TRANSFERS];
+    uint8_t TransferCommands[SSD1309_HEADROOM + SSD1309_MAX_COMMANDS];
+    uint16_t TransferCount;
+    uint16_t CommandCount;
+    volatile uint16_t TransferIndex;
+    volatile bool Busy;
+    ssd1309_done_handle DoneHandle;
+
+    /* Copy of the region in the order of the window, column-major for vertical addressing */
+    uint8_t FlushScratch[SSD1309_HEADROOM + SSD1309_FLUSH_SCRATCH_SIZE];
+
+    /* Source, order and position of the gather */
+    const uint8_t *GatherBuffer;
+    SSD1309_ADDRESSING GatherMode;
+    SSD1309_REGION GatherRegion;
+    uint8_t GatherX;
+    uint8_t GatherPage;
+
+    /* Bus usage of the last update */
+    ssd1309_timestamp_handle TimestampHandle;
+    SSD1309_Throughput_t Throughput;
+    uint32_t UpdateStart;
+
+#if defined(SSD1309_ENABLE_STATS)
+    SSD1309_Stats_t Stats;
+#endif
 } SSD1309_t;
 
 typedef struct
@@ -116,31 +378,126 @@ typedef struct
     uint8_t y;
 } SSD1309_VERTEX;
 
+/* Bitmap in the layout of the display RAM: (Height + 7) / 8 bands of Width */
+/* column bytes, bit 0 the top row of a band. Made by tools/bmpconv.py     */
+typedef struct
+{
+    uint8_t Width;
+    uint8_t Height;
+    const uint8_t *Data;
+    const uint8_t *Mask;    /* Same layout, pixels drawn by SSD1309_ROP_MASKED, NULL: Data */
+} SSD1309_Bitmap_t;
+
+/* Page-major bitmap run-length coded like the proportional fonts (see */
+/* ssd1309_fonts.h), made by tools/bmpconv.py --rle                    */
+typedef struct
+{
+    uint8_t Width;
+    uint8_t Height;
+    const uint8_t *Data;
+} SSD1309_Image_t;
+
+/* How ssd1309_DrawPageBitmap combines the bitmap with the screenbuffer */
+typedef enum
+{
+    SSD1309_ROP_COPY   = 0, /* Screen = bitmap                             */
+    SSD1309_ROP_OR     = 1, /* Set bits drawn White, the others left as is */
+    SSD1309_ROP_AND    = 2, /* Clear bits drawn Black                      */
+    SSD1309_ROP_XOR    = 3, /* Set bits invert the screen                  */
+    SSD1309_ROP_CLEAR  = 4, /* Set bits drawn Black                        */
+    SSD1309_ROP_MASKED = 5  /* Bitmap copied where the mask is set         */
+} SSD1309_ROP;
+
+/* Horizontal alignment of the lines of ssd1309_DrawText */
+typedef enum
+{
+    SSD1309_ALIGN_LEFT   = 0,
+    SSD1309_ALIGN_CENTER = 1,
+    SSD1309_ALIGN_RIGHT  = 2
+} SSD1309_ALIGN;
+
+/* Line breaking of ssd1309_DrawText, newlines always break */
+typedef enum
+{
+    SSD1309_WRAP_NONE = 0,  /* Lines wider than the box are cut off        */
+    SSD1309_WRAP_WORD = 1,  /* At spaces, a word wider than the box anywhere */
+    SSD1309_WRAP_CHAR = 2   /* At any character                            */
+} SSD1309_WRAP;
+
 
 /* Procedure definitions */
+SSD1309_Error_t ssd1309_Init(SSD1309_t *dev, const SSD1309_Config_t *config);
 #if defined(SSD1309_USE_I2C)
-void ssd1309_Init(ssd1309_i2c_handle i2c_comm_handle);
+void ssd1309_SetAsyncHandle(SSD1309_t *dev, ssd1309_i2c_handle i2c_async_handle);
 #elif defined(SSD1309_USE_SPI)
-void ssd1309_Init(ssd1309_spi_handle spi_comm_handle);
-#endif
-void ssd1309_SetContrast(const uint8_t value);
-
-void ssd1309_Fill(SSD1309_COLOR color);
-void ssd1309_UpdateScreen(void);
-void ssd1309_DrawPixel(uint8_t x, uint8_t y, SSD1309_COLOR color);
-void ssd1309_WriteSymbol(SymbolID_t Symbol, uint8_t x, uint8_t y);
-char ssd1309_WriteChar(char ch, FontDef Font, SSD1309_COLOR color);
-char ssd1309_WriteString(char* str, FontDef Font, SSD1309_COLOR color);
-void ssd1309_SetCursor(uint8_t x, uint8_t y);
-void ssd1309_DrawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1309_COLOR color);
-void ssd1309_DrawArc(uint8_t x, uint8_t y, uint8_t radius, uint16_t start_angle, uint16_t sweep, SSD1309_COLOR color);
-void ssd1309_DrawArcWithRadiusLine(uint8_t x, uint8_t y, uint8_t radius, uint16_t start_angle, uint16_t sweep, SSD1309_COLOR color);
-void ssd1309_DrawCircle(uint8_t par_x, uint8_t par_y, uint8_t par_r, SSD1309_COLOR color);
-void ssd1309_FillCircle(uint8_t par_x,uint8_t par_y, uint8_t par_r, SSD1309_COLOR par_color);
-void ssd1309_Polyline(const SSD1309_VERTEX *par_vertex, uint16_t par_size, SSD1309_COLOR color);
-void ssd1309_DrawRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1309_COLOR color);
-void ssd1309_FillRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1309_COLOR color);
-void ssd1309_DrawBitmap(uint8_t x, uint8_t y, const unsigned char* bitmap, uint8_t w, uint8_t h, SSD1309_COLOR color);
+void ssd1309_SetAsyncHandle(SSD1309_t *dev, ssd1309_spi_handle spi_async_handle);
+#endif
+void ssd1309_SetContrast(SSD1309_t *dev, const uint8_t value);
+SSD1309_Error_t ssd1309_SetRotation(SSD1309_t *dev, SSD1309_ROTATION rotation);
+SSD1309_Error_t ssd1309_PushClip(SSD1309_t *dev, const SSD1309_RECT *rect);
+SSD1309_Error_t ssd1309_PopClip(SSD1309_t *dev);
+void ssd1309_SetOrigin(SSD1309_t *dev, int16_t x, int16_t y);
+
+void ssd1309_Fill(SSD1309_t *dev, SSD1309_COLOR color);
+void ssd1309_UpdateScreen(SSD1309_t *dev);
+SSD1309_Error_t ssd1309_UpdateScreenAsync(SSD1309_t *dev, ssd1309_done_handle done_handle);
+bool ssd1309_IsBusy(SSD1309_t *dev);
+void ssd1309_TransferDone(SSD1309_t *dev);
+void ssd1309_Invalidate(SSD1309_t *dev);
+void ssd1309_SetFlushMode(SSD1309_t *dev, SSD1309_ADDRESSING mode);
+void ssd1309_SetTimestampHandle(SSD1309_t *dev, ssd1309_timestamp_handle timestamp_handle);
+void ssd1309_GetThroughput(SSD1309_t *dev, SSD1309_Throughput_t *throughput);
+#if defined(SSD1309_ENABLE_STATS)
+void ssd1309_GetStats(SSD1309_t *dev, SSD1309_Stats_t *stats);
+void ssd1309_ResetStats(SSD1309_t *dev);
+#endif
+SSD1309_Error_t ssd1309_StartScroll(SSD1309_t *dev, SSD1309_SCROLL direction, uint8_t start_page, uint8_t end_page,
+                                    SSD1309_SCROLL_INTERVAL interval, uint8_t vertical_offset);
+void ssd1309_StopScroll(SSD1309_t *dev);
+bool ssd1309_IsScrolling(SSD1309_t *dev);
+void ssd1309_SetStartLine(SSD1309_t *dev, uint8_t line);
+void ssd1309_DrawPixel(SSD1309_t *dev, uint8_t x, uint8_t y, SSD1309_COLOR color);
+void ssd1309_WriteSymbol(SSD1309_t *dev, SymbolID_t Symbol, uint8_t x, uint8_t y);
+char ssd1309_WriteChar(SSD1309_t *dev, char ch, FontDef Font, SSD1309_COLOR color);
+char ssd1309_WriteString(SSD1309_t *dev, char* str, FontDef Font, SSD1309_COLOR color);
+uint16_t ssd1309_WriteGlyph(SSD1309_t *dev, uint16_t code, const SSD1309_Font_t *Font, SSD1309_COLOR color);
+void ssd1309_WriteText(SSD1309_t *dev, const char *str, const SSD1309_Font_t *Font, SSD1309_COLOR color);
+uint16_t ssd1309_MeasureString(const char *str, const SSD1309_Font_t *Font, uint16_t *height);
+const char *ssd1309_DrawText(SSD1309_t *dev, const SSD1309_RECT *rect, const char *str, const SSD1309_Font_t *Font,
+                             SSD1309_ALIGN align, SSD1309_WRAP wrap, SSD1309_COLOR color);
+void ssd1309_SetCursor(SSD1309_t *dev, uint8_t x, uint8_t y);
+void ssd1309_DrawLine(SSD1309_t *dev, uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1309_COLOR color);
+void ssd1309_DrawHLine(SSD1309_t *dev, uint8_t x1, uint8_t x2, uint8_t y, SSD1309_COLOR color);
+void ssd1309_DrawVLine(SSD1309_t *dev, uint8_t x, uint8_t y1, uint8_t y2, SSD1309_COLOR color);
+void ssd1309_DrawArc(SSD1309_t *dev, uint8_t x, uint8_t y, uint8_t radius, uint16_t start_angle, uint16_t sweep, SSD1309_COLOR color);
+void ssd1309_DrawArcWithRadiusLine(SSD1309_t *dev, uint8_t x, uint8_t y, uint8_t radius, uint16_t start_angle, uint16_t sweep, SSD1309_COLOR color);
+void ssd1309_FillPie(SSD1309_t *dev, uint8_t x, uint8_t y, uint8_t radius, uint16_t start_angle, uint16_t end_angle, SSD1309_COLOR color);
+void ssd1309_FillRing(SSD1309_t *dev, uint8_t x, uint8_t y, uint8_t radius, uint8_t thickness,
+                      uint16_t start_angle, uint16_t end_angle, SSD1309_COLOR color);
+void ssd1309_DrawCircle(SSD1309_t *dev, uint8_t par_x, uint8_t par_y, uint8_t par_r, SSD1309_COLOR color);
+void ssd1309_FillCircle(SSD1309_t *dev, uint8_t par_x,uint8_t par_y, uint8_t par_r, SSD1309_COLOR par_color);
+void ssd1309_FillRoundRect(SSD1309_t *dev, uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t r, SSD1309_COLOR color);
+void ssd1309_DrawEllipse(SSD1309_t *dev, uint8_t par_x, uint8_t par_y, uint8_t rx, uint8_t ry, SSD1309_COLOR color);
+void ssd1309_FillEllipse(SSD1309_t *dev, uint8_t par_x, uint8_t par_y, uint8_t rx, uint8_t ry, SSD1309_COLOR color);
+void ssd1309_Polyline(SSD1309_t *dev, const SSD1309_VERTEX *par_vertex, uint16_t par_size, SSD1309_COLOR color);
+void ssd1309_DrawRectangle(SSD1309_t *dev, uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1309_COLOR color);
+void ssd1309_FillRectangle(SSD1309_t *dev, uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1309_COLOR color);
+void ssd1309_DrawBitmap(SSD1309_t *dev, uint8_t x, uint8_t y, const unsigned char* bitmap, uint8_t w, uint8_t h, SSD1309_COLOR color);
+void ssd1309_DrawPageBitmap(SSD1309_t *dev, uint8_t x, uint8_t y, const SSD1309_Bitmap_t *bitmap, SSD1309_ROP rop);
+SSD1309_Error_t ssd1309_StreamImage(SSD1309_t *dev, uint8_t x, uint8_t page, const SSD1309_Image_t *image);
+
+/**
+ * @brief Initializes a display and clears it.
+ * @param[out] dev    state of the display, owned by the caller.
+ * @param[in]  config geometry, screenbuffer(s) and transport of the display.
+ * @retval SSD1309_OK  display initialized.
+ * @retval SSD1309_ERR unsupported height or missing buffer.
+ * @note Every display has its own dev, so several panels (e.g. a 128x64
+ *       and a 128x32) can be driven and flushed independently. On SPI give
+ *       each panel its own handles so they can select their chip.
+ * @note Register the async and timestamp handles after this call.
+ */
+SSD1309_Error_t ssd1309_Init(SSD1309_t *dev, const SSD1309_Config_t *config);
 
 /**
  * @brief Sets the contrast of the display.
@@ -148,12 +505,318 @@ void ssd1309_DrawBitmap(uint8_t x, uint8_t y, const unsigned char* bitmap, uint8
  * @note Contrast increases as the value increases.
  * @note RESET = 7Fh.
  */
-void ssd1309_SetContrast(const uint8_t value);
+void ssd1309_SetContrast(SSD1309_t *dev, const uint8_t value);
+
+/**
+ * @brief Rotates the screen clockwise for the drawing functions.
+ * @retval SSD1309_OK   rotation set.
+ * @retval SSD1309_BUSY an update is on the bus.
+ * @retval SSD1309_ERR  unknown rotation.
+ * @note 180 degrees flips the segment re-map and COM scan direction of the
+ *       panel, drawing costs nothing more. The re-map only applies to data
+ *       written after it, so turning into or out of 180 and 270 degrees
+ *       makes the next update send the whole screenbuffer again.
+ *       90 degrees swaps width and height: rows of the screen are drawn
+ *       into screenbuffer columns, eight at a time by the text, span and
+ *       page bitmap kernels. 270 degrees is 90 plus the panel flip.
+ * @note Draw the screen again after turning between landscape and portrait.
+ *       With a negative OffsetX the last -OffsetX rows of a portrait screen
+ *       are off the glass. ssd1309_StreamImage and the hardware scroll keep
+ *       working in panel coordinates. The clip and origin are reset.
+ */
+SSD1309_Error_t ssd1309_SetRotation(SSD1309_t *dev, SSD1309_ROTATION rotation);
+
+/**
+ * @brief Restricts drawing to rect until the matching ssd1309_PopClip().
+ * @param[in] rect box relative to the origin, intersected with the clip in
+ *            force: nested clips only ever shrink.
+ * @retval SSD1309_OK  clip pushed, possibly empty.
+ * @retval SSD1309_ERR SSD1309_CLIP_DEPTH clips are pushed already.
+ * @note Every primitive (ssd1309_Fill included) intersects its geometry with
+ *       the clip once and only visits the pixels inside it, so widgets partly
+ *       scrolled out of a list cost what they show.
+ */
+SSD1309_Error_t ssd1309_PushClip(SSD1309_t *dev, const SSD1309_RECT *rect);
+
+/**
+ * @brief Restores the clip and origin saved by the last ssd1309_PushClip().
+ * @retval SSD1309_ERR no clip is pushed.
+ */
+SSD1309_Error_t ssd1309_PopClip(SSD1309_t *dev);
+
+/**
+ * @brief Moves the coordinates of the drawing functions and the cursor: x, y
+ *        of the screen becomes 0, 0.
+ * @note Either may be negative, e.g. the scroll position of a list. The
+ *       origin is part of the view saved by ssd1309_PushClip(), a pop puts
+ *       the previous one back.
+ */
+void ssd1309_SetOrigin(SSD1309_t *dev, int16_t x, int16_t y);
+
+/**
+ * @brief Sends only the pages and columns changed since the last update.
+ * @note Every write into the screenbuffer records the dirty column span
+ *       of its page, so a small change costs a few dozen bytes on the bus.
+ * @note With a Shadow in the config the dirty spans are compared with the
+ *       display RAM and only the runs of changed bytes are sent; runs closer
+ *       than the cost of a new column address are merged.
+ */
+void ssd1309_UpdateScreen(SSD1309_t *dev);
+
+/**
+ * @brief Starts sending the changes without waiting for the bus.
+ * @param[in] done_handle called (from the context of ssd1309_TransferDone())
+ *            once the last transfer of the update has completed, may be NULL.
+ * @retval SSD1309_OK   update started (or nothing to send).
+ * @retval SSD1309_BUSY the previous update is still on the bus, or the
+ *                      panel is scrolling.
+ * @note Transfers go through the handle registered with
+ *       ssd1309_SetAsyncHandle(), which must return immediately and call
+ *       ssd1309_TransferDone() when each transfer completes. Without it the
+ *       update is sent synchronously and done_handle is called at once.
+ * @note With a BackBuffer in the config drawing may continue while the
+ *       previous frame is on the bus, otherwise the screenbuffer must not be
+ *       touched until done_handle is called.
+ */
+SSD1309_Error_t ssd1309_UpdateScreenAsync(SSD1309_t *dev, ssd1309_done_handle done_handle);
+
+/**
+ * @brief Reports the completion of the transfer started by the async handle.
+ * @note Call it from the transport's event handler, it starts the next
+ *       transfer of the update or calls the done handle.
+ */
+void ssd1309_TransferDone(SSD1309_t *dev);
+
+/**
+ * @brief Marks the whole screenbuffer as changed.
+ * @note Use it when the display RAM was lost (e.g. after a panel reset),
+ *       the next ssd1309_UpdateScreen() then sends the full frame and
+ *       reloads the shadow.
+ */
+void ssd1309_Invalidate(SSD1309_t *dev);
+
+/**
+ * @brief Selects the addressing mode used by ssd1309_UpdateScreen().
+ * @param[in] mode SSD1309_ADDRESSING_AUTO (default) estimates the bus cost
+ *            of page, horizontal and vertical addressing for the dirty
+ *            region and picks the cheapest one, any other value forces it.
+ * @note Horizontal and vertical modes set the column/page window once with
+ *       0x21/0x22 and stream the data without per-page commands. Horizontal
+ *       windows spanning whole screenbuffer rows go in one burst; columns
+ *       off the panel (SSD1309_OFFSET_X) lie between the rows otherwise, and
+ *       these are gathered back to back through the flush scratch buffer
+ *       when that takes fewer transactions than one per page.
+ */
+void ssd1309_SetFlushMode(SSD1309_t *dev, SSD1309_ADDRESSING mode);
+
+/**
+ * @brief Reports the bus usage of the last update.
+ * @param[out] throughput bytes and transactions of the last update and,
+ *             with a timestamp handle registered, its duration in ticks.
+ * @note On I2C every transaction also costs a start, the address byte and a
+ *       stop: (Bytes + Transactions) * 9 bits is the time on the wire, so
+ *       Ticks against it tells whether 400 kHz or 1 MHz is worth it.
+ */
+void ssd1309_GetThroughput(SSD1309_t *dev, SSD1309_Throughput_t *throughput);
+
+#if defined(SSD1309_ENABLE_STATS)
+/**
+ * @brief Reports what the display cost since init or the last reset.
+ * @param[out] stats bus bytes and transactions, updates sent and skipped,
+ *             pixels drawn and, with a timestamp handle registered, a log2
+ *             histogram of the update durations.
+ * @note A high SkippedFlushes count or Pixels growing every tick on a
+ *       static screen point at UI code flushing or redrawing too often.
+ * @note Only built with SSD1309_ENABLE_STATS, the counters cost nothing
+ *       otherwise.
+ */
+void ssd1309_GetStats(SSD1309_t *dev, SSD1309_Stats_t *stats);
+
+/**
+ * @brief Clears the counters of ssd1309_GetStats().
+ */
+void ssd1309_ResetStats(SSD1309_t *dev);
+#endif
+
+/**
+ * @brief Starts the hardware scrolling of a band of pages.
+ * @param[in] direction       horizontal, diagonal or vertical scroll.
+ * @param[in] start_page      first page moved horizontally, 0-7.
+ * @param[in] end_page        last page moved horizontally, start_page-7.
+ * @param[in] interval        frames between two steps.
+ * @param[in] vertical_offset rows moved up per step (diagonal and vertical
+ *            scrolls), 1 to 63 and below the height.
+ * @retval SSD1309_OK   the panel scrolls without any further bus traffic.
+ * @retval SSD1309_BUSY an asynchronous update is still on the bus.
+ * @retval SSD1309_ERR  invalid page range or offset, or a portrait rotation.
+ * @note The display RAM must not be written while scrolling: updates are
+ *       held back, drawing still goes to the screenbuffer and is sent once
+ *       ssd1309_StopScroll() is called. A scroll already running is stopped
+ *       first, as by ssd1309_StopScroll(). Vertical scrolls move the top 64
+ *       rows at most.
+ */
+SSD1309_Error_t ssd1309_StartScroll(SSD1309_t *dev, SSD1309_SCROLL direction, uint8_t start_page, uint8_t end_page,
+                                    SSD1309_SCROLL_INTERVAL interval, uint8_t vertical_offset);
+
+/**
+ * @brief Stops the hardware scrolling.
+ * @note Horizontal scrolling moves the display RAM itself, so the scrolled
+ *       pages are sent again from the screenbuffer: the panel then shows the
+ *       screenbuffer, as before the scroll started, plus any drawing done
+ *       meanwhile.
+ */
+void ssd1309_StopScroll(SSD1309_t *dev);
+
+/**
+ * @brief Draws a glyph of a proportional font at the cursor and advances
+ *        the cursor by its advance width.
+ * @param[in] code code point of the glyph.
+ * @retval code the glyph was drawn.
+ * @retval 0    the font has no glyph for code, nothing changed.
+ * @note The cursor is the top left of the line. Only the set pixels of the
+ *       glyph are drawn, clipped to the clip: clear the area first when
+ *       replacing text. The glyph is decoded straight into the screenbuffer.
+ */
+uint16_t ssd1309_WriteGlyph(SSD1309_t *dev, uint16_t code, const SSD1309_Font_t *Font, SSD1309_COLOR color);
+
+/**
+ * @brief Writes a UTF-8 string in a proportional font at the cursor.
+ * @note Characters the font lacks, beyond U+FFFF or malformed are skipped,
+ *       text is clipped to the clip.
+ */
+void ssd1309_WriteText(SSD1309_t *dev, const char *str, const SSD1309_Font_t *Font, SSD1309_COLOR color);
+
+/**
+ * @brief Draws a page-major bitmap at x, y combined by rop, clipped to the
+ *        clip.
+ * @note A byte operation per column and page: the bitmap is shifted onto
+ *       the page grid for any y, a full page aligned COPY is a memcpy.
+ *       Unlike ssd1309_DrawBitmap, COPY and MASKED draw clear pixels too.
+ */
+void ssd1309_DrawPageBitmap(SSD1309_t *dev, uint8_t x, uint8_t y, const SSD1309_Bitmap_t *bitmap, SSD1309_ROP rop);
+
+/**
+ * @brief Decodes a run-length coded image straight to the display RAM at
+ *        column x of page page, without going through the screenbuffer.
+ * @retval SSD1309_OK   the image is on the panel.
+ * @retval SSD1309_BUSY an update is on the bus or the panel scrolls.
+ * @retval SSD1309_ERR  the image does not fit the visible display RAM.
+ * @note Meant for boot splashes and full screen art: the screenbuffer keeps
+ *       its content, the next update only sends what was drawn since, and
+ *       ssd1309_Invalidate() puts the screenbuffer back. The shadow, when
+ *       there is one, is kept up to date. The bytes are decoded into the
+ *       flush scratch buffer, SSD1309_FLUSH_SCRATCH_SIZE at most per transfer.
+ */
+SSD1309_Error_t ssd1309_StreamImage(SSD1309_t *dev, uint8_t x, uint8_t page, const SSD1309_Image_t *image);
+
+/**
+ * @brief Measures a UTF-8 string in a proportional font.
+ * @param[out] height lines times the font height, may be NULL.
+ * @retval Width of the widest line, up to the right of its last ink.
+ */
+uint16_t ssd1309_MeasureString(const char *str, const SSD1309_Font_t *Font, uint16_t *height);
+
+/**
+ * @brief Lays out a UTF-8 string in rect: breaks and aligns every line once
+ *        and draws its glyphs clipped to rect and the clip, partly visible
+ *        ones included.
+ * @param[in] rect box of the text, lines start at its top.
+ * @retval The text that did not fit below the box, starting with a line cut
+ *         off at the bottom, or the terminating null when all of it fit.
+ * @note Glyphs are transparent like in ssd1309_WriteText. The cursor is not
+ *       used nor moved.
+ */
+const char *ssd1309_DrawText(SSD1309_t *dev, const SSD1309_RECT *rect, const char *str, const SSD1309_Font_t *Font,
+                             SSD1309_ALIGN align, SSD1309_WRAP wrap, SSD1309_COLOR color);
+
+/**
+ * @brief Draws a horizontal line from x1 to x2 (inclusive, any order) on row y.
+ * @note Clipped to the clip. One bit mask is applied across the
+ *       columns, no per-pixel addressing.
+ */
+void ssd1309_DrawHLine(SSD1309_t *dev, uint8_t x1, uint8_t x2, uint8_t y, SSD1309_COLOR color);
+
+/**
+ * @brief Draws a vertical line from y1 to y2 (inclusive, any order) in column x.
+ * @note Clipped to the clip. Whole bytes are written per page, with
+ *       a mask on the first and last page.
+ */
+void ssd1309_DrawVLine(SSD1309_t *dev, uint8_t x, uint8_t y1, uint8_t y2, SSD1309_COLOR color);
+
+/**
+ * @brief Draws the points of ssd1309_DrawCircle that lie between two angles.
+ * @param[in] start_angle first angle in degrees, 0 points down from x, y and
+ *            angles grow towards the right (90), up (180) and left (270).
+ * @param[in] sweep last angle in degrees, an end below the start wraps
+ *            through 0, 360 or more past the start draws the whole circle.
+ * @note Integer only: the angles are taken from a Q14 sine table. Clipped to
+ *       the clip.
+ */
+void ssd1309_DrawArc(SSD1309_t *dev, uint8_t x, uint8_t y, uint8_t radius, uint16_t start_angle, uint16_t sweep, SSD1309_COLOR color);
+
+/**
+ * @brief Draws a filled pie: the pixels of ssd1309_FillCircle between two
+ *        angles, counted as in ssd1309_DrawArc.
+ * @note One to four horizontal spans per row, clipped to the clip. Shares
+ *       its edges with ssd1309_DrawArc of the same angles.
+ */
+void ssd1309_FillPie(SSD1309_t *dev, uint8_t x, uint8_t y, uint8_t radius, uint16_t start_angle, uint16_t end_angle, SSD1309_COLOR color);
+
+/**
+ * @brief Draws a filled ring between two angles, counted as in ssd1309_DrawArc:
+ *        a pie of radius without the pie of radius - thickness.
+ * @param[in] thickness width of the ring, radius or more gives a full pie.
+ * @note One to four horizontal spans per row, clipped to the clip.
+ */
+void ssd1309_FillRing(SSD1309_t *dev, uint8_t x, uint8_t y, uint8_t radius, uint8_t thickness,
+                      uint16_t start_angle, uint16_t end_angle, SSD1309_COLOR color);
+
+/**
+ * @brief Draws a filled circle of radius par_r around par_x, par_y.
+ * @note One horizontal span per row, clipped: circles may cross any edge.
+ */
+void ssd1309_FillCircle(SSD1309_t *dev, uint8_t par_x,uint8_t par_y, uint8_t par_r, SSD1309_COLOR par_color);
+
+/**
+ * @brief Draws a filled rectangle between two corners (inclusive, any order)
+ *        with its corners rounded by radius r.
+ * @note r is limited to half of the shorter side, 0 gives a plain rectangle.
+ */
+void ssd1309_FillRoundRect(SSD1309_t *dev, uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t r, SSD1309_COLOR color);
+
+/**
+ * @brief Draws the outline of an ellipse with radii rx, ry around par_x, par_y.
+ * @note Clipped to the clip, only the points of a partly visible ellipse
+ *       are checked against it.
+ */
+void ssd1309_DrawEllipse(SSD1309_t *dev, uint8_t par_x, uint8_t par_y, uint8_t rx, uint8_t ry, SSD1309_COLOR color);
+
+/**
+ * @brief Draws a filled ellipse with radii rx, ry around par_x, par_y.
+ * @note One horizontal span per row, clipped to the clip.
+ */
+void ssd1309_FillEllipse(SSD1309_t *dev, uint8_t par_x, uint8_t par_y, uint8_t rx, uint8_t ry, SSD1309_COLOR color);
+
+/**
+ * @brief Sets the display RAM row shown on the top line of the glass.
+ * @param[in] line start line, 0-63: glass row y shows RAM row (y + line) % 64.
+ * @note The command goes out behind the data of the next update, so content
+ *       drawn for the new position and the move appear together.
+ */
+void ssd1309_SetStartLine(SSD1309_t *dev, uint8_t line);
 
 /* Low-level procedures	*/
-void ssd1309_Reset(void);
-void ssd1309_WriteCommand(uint8_t byte);
-void ssd1309_WriteData(uint8_t* buffer, size_t buff_size);
-SSD1309_Error_t ssd1309_FillBuffer(uint8_t *buf, uint32_t len);
+void ssd1309_Reset(SSD1309_t *dev);
+void ssd1309_WriteCommand(SSD1309_t *dev, uint8_t byte);
+void ssd1309_WriteCommands(SSD1309_t *dev, const uint8_t *cmds, size_t n);
+void ssd1309_WriteData(SSD1309_t *dev, uint8_t* buffer, size_t buff_size);
+SSD1309_Error_t ssd1309_FillBuffer(SSD1309_t *dev, uint8_t *buf, uint32_t len);
+
+/* Benchmark hooks: with SSD1309_TRACE defined the driver reports every */
+/* screenbuffer write to these, the application provides them           */
+#if defined(SSD1309_TRACE)
+void ssd1309_TracePixel(SSD1309_t *dev, uint8_t x, uint8_t y);
+void ssd1309_TraceBytes(SSD1309_t *dev, uint32_t offset, uint32_t length);
+#endif
 
 #endif /* __SSD1309_H__	*/
@@ -6,13 +6,18 @@
 #ifndef __SSD1309_CONF_H__
 #define __SSD1309_CONF_H__
 
-// Choose a bus
+// Choose a bus (unless the build already did)
+#if !defined(SSD1309_USE_I2C) && !defined(SSD1309_USE_SPI)
 // #define SSD1309_USE_I2C
 #define SSD1309_USE_SPI
+#endif
 
 // I2C Configuration
 #if defined(SSD1309_USE_I2C)
 #define SSD1309_I2C_ADDR        (0x3C)
+// Largest write of the TWI driver, updates are split in
+// chunks of this size (control byte included)
+#define SSD1309_I2C_MAX_TRANSFER 255
 #endif
 
 // SPI Configuration
@@ -51,8 +56,39 @@
 // adjust the vertical offset
 // #define SSD1309_OFFSET_Y
 
+// Bus overhead of one transaction in data byte times,
+// used to choose page, horizontal or vertical addressing
+// when flushing. Raise it for slow drivers, lower it for
+// DMA transports. The default value is 8.
+// #define SSD1309_TRANSACTION_COST 8
+
+// Runs of changed bytes sent per page when a display has
+// a shadow of its RAM, raise it for UIs with many small
+// scattered changes. The default value is 4.
+// #define SSD1309_MAX_RUNS        4
+
+// Clips ssd1309_PushClip() can nest, every level costs
+// 8 bytes of SSD1309_t. The default value is 4.
+// #define SSD1309_CLIP_DEPTH      4
+
 // The height can be changed as well if necessary.
 // It can be 32, 64 or 128. The default value is 64.
 // #define SSD1309_HEIGHT          64
 
+// Width, height and offsets above are defaults for the
+// application, every display gets its own geometry in
+// the SSD1309_Config_t passed to ssd1309_Init().
+// Pages (height / 8) of the tallest display driven,
+// sizes the update state of each SSD1309_t.
+// #define SSD1309_MAX_PAGES       8
+
+// Count bus traffic, updates and pixels drawn for
+// ssd1309_GetStats(), compiled out when not defined.
+// #define SSD1309_ENABLE_STATS
+
+// Report every screenbuffer write to ssd1309_TracePixel()
+// and ssd1309_TraceBytes(), provided by the application.
+// Used by the benchmark in host/, leave it off otherwise.
+// #define SSD1309_TRACE
+
 #endif /* __SSD1309_CONF_H__ */
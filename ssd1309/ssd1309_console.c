@@ -0,0 +1,217 @@
+#include "ssd1309_console.h"
+
+/* Rows of display RAM the start line wraps around */
+#define SSD1309_CONSOLE_RAM_ROWS    64
+
+
+/* First line on the glass when the view is the given number of lines back */
+static uint32_t ssd1309_ConsoleTop(SSD1309_Console_t *con, uint32_t view)
+{
+    return ((con->Newest + 1) > (view + con->Rows)) ? (con->Newest + 1 - view - con->Rows) : 0;
+}
+
+
+/* Text of a line, NULL once it left the ring */
+static const char *ssd1309_ConsoleText(SSD1309_Console_t *con, uint32_t line)
+{
+    uint32_t age = con->Newest - line;
+
+    if (age >= con->Count)
+    {
+        return NULL;
+    }
+
+    return &con->History[((con->Head + con->Lines - age) % con->Lines) * SSD1309_CONSOLE_MAX_COLUMNS];
+}
+
+
+/* Draw a character of the newest line at the given column */
+static void ssd1309_ConsoleDrawChar(SSD1309_Console_t *con, uint32_t line, uint8_t column, char ch)
+{
+    con->Dev->CurrentX = con->Left + column * con->Font->FontWidth;
+    con->Dev->CurrentY = (line % con->Rows) * con->Pitch;
+
+    ssd1309_WriteChar(con->Dev, ch, *con->Font, con->Color);
+}
+
+
+/* Render a line into its rows of the screenbuffer */
+static void ssd1309_ConsoleRender(SSD1309_Console_t *con, uint32_t line)
+{
+    const char *text = ssd1309_ConsoleText(con, line);
+    uint8_t y = (line % con->Rows) * con->Pitch;
+
+    ssd1309_FillRectangle(con->Dev, 0, y, con->Dev->Width - 1, y + con->Pitch - 1, (SSD1309_COLOR)!con->Color);
+
+    if (NULL == text)
+    {
+        return;
+    }
+
+    for (uint8_t i = 0; (i < con->Columns) && (text[i] != '\0'); i++)
+    {
+        ssd1309_ConsoleDrawChar(con, line, i, text[i]);
+    }
+}
+
+
+/* Show the lines the given number of lines back, rendering only the ones not on the glass yet */
+static void ssd1309_ConsoleShow(SSD1309_Console_t *con, uint32_t view)
+{
+    uint32_t old_top = ssd1309_ConsoleTop(con, con->View);
+    uint32_t top     = ssd1309_ConsoleTop(con, view);
+
+    for (uint32_t line = top; (line < (top + con->Rows)) && (line <= con->Newest); line++)
+    {
+        if ((line < old_top) || (line >= (old_top + con->Rows)))
+        {
+            ssd1309_ConsoleRender(con, line);
+        }
+    }
+
+    con->View = view;
+    ssd1309_SetStartLine(con->Dev, (top % con->Rows) * con->Pitch);
+}
+
+
+/* Start a new line, it takes the rows of the oldest line on the glass */
+static void ssd1309_ConsoleNewLine(SSD1309_Console_t *con)
+{
+    con->Newest++;
+    con->Head   = (con->Head + 1) % con->Lines;
+    con->Column = 0;
+
+    if (con->Count < con->Lines)
+    {
+        con->Count++;
+    }
+
+    memset(&con->History[con->Head * SSD1309_CONSOLE_MAX_COLUMNS], 0, SSD1309_CONSOLE_MAX_COLUMNS);
+
+    ssd1309_ConsoleRender(con, con->Newest);
+    ssd1309_SetStartLine(con->Dev, (ssd1309_ConsoleTop(con, 0) % con->Rows) * con->Pitch);
+}
+
+
+/* Take over a display as a text console */
+SSD1309_Error_t ssd1309_ConsoleInit(SSD1309_Console_t *con, SSD1309_t *dev, const FontDef *Font,
+                                    char *history, uint16_t lines)
+{
+    uint8_t right;
+
+    if ((NULL == dev) || (NULL == history) || (dev->Height != SSD1309_CONSOLE_RAM_ROWS) ||
+        (dev->Rotation == ROTATION_90) || (dev->Rotation == ROTATION_270) || (NULL == Font) || (Font->FontHeight == 0) || (Font->FontHeight > 32) ||
+        (dev->ClipDepth != 0) || (dev->OriginX != 0) || (dev->OriginY != 0))
+    {
+        return SSD1309_ERR;
+    }
+
+    /* Lines must tile the display RAM for the start line to wrap cleanly */
+    con->Pitch = 8;
+    while (con->Pitch < Font->FontHeight)
+    {
+        con->Pitch *= 2;
+    }
+    con->Rows = SSD1309_CONSOLE_RAM_ROWS / con->Pitch;
+
+    if (lines < con->Rows)
+    {
+        return SSD1309_ERR;
+    }
+
+    /* Characters go in the screenbuffer columns shown on the glass */
+    con->Left = (dev->OffsetX < 0) ? -dev->OffsetX : 0;
+    right     = ((dev->Width + dev->OffsetX) > SSD1309_COLUMNS) ? (SSD1309_COLUMNS - dev->OffsetX) : dev->Width;
+
+    con->Columns = (right - con->Left) / Font->FontWidth;
+    if (con->Columns > SSD1309_CONSOLE_MAX_COLUMNS)
+    {
+        con->Columns = SSD1309_CONSOLE_MAX_COLUMNS;
+    }
+
+    con->Dev     = dev;
+    con->Font    = Font;
+    con->Color   = White;
+    con->History = history;
+    con->Lines   = lines;
+    con->Head    = 0;
+    con->Count   = 1;
+    con->Newest  = 0;
+    con->View    = 0;
+    con->Column  = 0;
+
+    memset(history, 0, SSD1309_CONSOLE_HISTORY_SIZE(lines));
+
+    ssd1309_Fill(dev, Black);
+    ssd1309_SetStartLine(dev, 0);
+
+    return SSD1309_OK;
+}
+
+
+/* Write a character at the cursor */
+void ssd1309_ConsolePutChar(SSD1309_Console_t *con, char ch)
+{
+    if (con->View != 0)
+    {
+        /* Back to the newest lines */
+        ssd1309_ConsoleShow(con, 0);
+    }
+
+    if (ch == '\n')
+    {
+        ssd1309_ConsoleNewLine(con);
+    }
+    else if (ch == '\r')
+    {
+        con->Column = 0;
+    }
+    else if ((ch >= 32) && (ch <= 126))
+    {
+        if (con->Column >= con->Columns)
+        {
+            ssd1309_ConsoleNewLine(con);
+        }
+
+        con->History[con->Head * SSD1309_CONSOLE_MAX_COLUMNS + con->Column] = ch;
+        ssd1309_ConsoleDrawChar(con, con->Newest, con->Column, ch);
+        con->Column++;
+    }
+    else { /* Nothing to do */ }
+}
+
+
+/* Write a string at the cursor */
+void ssd1309_ConsoleWrite(SSD1309_Console_t *con, const char *str)
+{
+    while (*str)
+    {
+        ssd1309_ConsolePutChar(con, *str);
+        str++;
+    }
+}
+
+
+/* Page through the scrollback ring */
+void ssd1309_ConsoleScrollBack(SSD1309_Console_t *con, int32_t lines)
+{
+    uint32_t oldest = con->Newest + 1 - con->Count;
+    uint32_t top    = ssd1309_ConsoleTop(con, 0);
+    uint32_t max    = (top > oldest) ? (top - oldest) : 0;
+    int32_t view    = (int32_t)con->View + lines;
+
+    if (view < 0)
+    {
+        view = 0;
+    }
+    else if ((uint32_t)view > max)
+    {
+        view = max;
+    }
+    else { /* Nothing to do */ }
+
+    if ((uint32_t)view != con->View)
+    {
+        ssd1309_ConsoleShow(con, view);
+    }
+}
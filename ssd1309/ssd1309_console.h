@@ -0,0 +1,81 @@
+/**
+ * Text console for the SSD1309 driver.
+ *
+ * Lines are rendered into the screenbuffer at a fixed pitch and scrolled
+ * with the display start line, so a new line only dirties the pages of
+ * that line. A ring of past lines in RAM allows paging back.
+ */
+
+#ifndef __SSD1309_CONSOLE_H__
+#define __SSD1309_CONSOLE_H__
+
+#include "ssd1309.h"
+
+/* Characters kept per line in the scrollback ring */
+#ifndef SSD1309_CONSOLE_MAX_COLUMNS
+#define SSD1309_CONSOLE_MAX_COLUMNS 32
+#endif
+
+/* Bytes to reserve for a scrollback ring of the given number of lines */
+#define SSD1309_CONSOLE_HISTORY_SIZE(lines) ((lines) * SSD1309_CONSOLE_MAX_COLUMNS)
+
+/* State of a console, owned by the application */
+typedef struct
+{
+    SSD1309_t *Dev;
+    const FontDef *Font;
+    SSD1309_COLOR Color;
+    uint8_t Columns;    /* Characters per line                       */
+    uint8_t Rows;       /* Lines on the glass                        */
+    uint8_t Pitch;      /* Display RAM rows per line: 8, 16 or 32    */
+    uint8_t Left;       /* Screenbuffer column of the first character */
+    uint8_t Column;     /* Cursor in the newest line                 */
+    char *History;      /* Ring of Lines lines                       */
+    uint16_t Lines;
+    uint16_t Head;      /* Ring index of the newest line             */
+    uint16_t Count;     /* Lines held in the ring                    */
+    uint32_t Newest;    /* Number of the newest line since init      */
+    uint32_t View;      /* Lines scrolled back, 0: following output  */
+} SSD1309_Console_t;
+
+
+/* Procedure definitions */
+SSD1309_Error_t ssd1309_ConsoleInit(SSD1309_Console_t *con, SSD1309_t *dev, const FontDef *Font,
+                                    char *history, uint16_t lines);
+void ssd1309_ConsolePutChar(SSD1309_Console_t *con, char ch);
+void ssd1309_ConsoleWrite(SSD1309_Console_t *con, const char *str);
+void ssd1309_ConsoleScrollBack(SSD1309_Console_t *con, int32_t lines);
+
+/**
+ * @brief Takes over a display as a text console and clears it.
+ * @param[in] history ring of SSD1309_CONSOLE_HISTORY_SIZE(lines) bytes.
+ * @param[in] lines   lines kept for paging back, at least one screen.
+ * @retval SSD1309_OK  console ready.
+ * @retval SSD1309_ERR the display is not 64 rows high (the start line
+ *                     wraps around the 64 rows of display RAM), is
+ *                     rotated to portrait, has a clip pushed or its
+ *                     origin moved, or the ring is smaller than a screen.
+ * @note Each line takes 8, 16 or 32 rows, the font height rounded up so
+ *       the lines tile the display RAM.
+ */
+SSD1309_Error_t ssd1309_ConsoleInit(SSD1309_Console_t *con, SSD1309_t *dev, const FontDef *Font,
+                                    char *history, uint16_t lines);
+
+/**
+ * @brief Writes a character at the cursor.
+ * @note '\n' starts a new line, '\r' returns to the start of the line, long
+ *       lines wrap. A new line on a full screen moves the start line and
+ *       clears the oldest line for it: the next ssd1309_UpdateScreen() sends
+ *       the pages of that line and the start line only.
+ */
+void ssd1309_ConsolePutChar(SSD1309_Console_t *con, char ch);
+
+/**
+ * @brief Pages through the scrollback ring.
+ * @param[in] lines lines to go back (positive) or forward (negative),
+ *            clamped to the ring. Writing returns to the newest lines.
+ * @note Only the lines brought into view are rendered.
+ */
+void ssd1309_ConsoleScrollBack(SSD1309_Console_t *con, int32_t lines);
+
+#endif /* __SSD1309_CONSOLE_H__ */
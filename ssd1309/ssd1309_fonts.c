@@ -1,5 +1,8 @@
 #include "ssd1309_fonts.h"
+#include "ssd1309_fonts_page.h"
+#include "ssd1309_fonts_prop.h"
 
+#if defined(SSD1309_INCLUDE_FONT_7x10)
 static const uint16_t Font7x10 [] = {
 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // sp
 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,  // !
@@ -97,7 +100,9 @@ static const uint16_t Font7x10 [] = {
 0x3000, 0x1000, 0x1000, 0x1000, 0x0800, 0x0800, 0x1000, 0x1000, 0x1000, 0x3000,  // }
 0x0000, 0x0000, 0x0000, 0x7400, 0x4C00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // ~
 };
+#endif
 
+#if defined(SSD1309_INCLUDE_FONT_11x18)
 static const uint16_t Font11x18 [] = {
 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // sp
 0x0000, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0000, 0x0C00, 0x0C00, 0x0000, 0x0000, 0x0000,   // !
@@ -195,7 +200,9 @@ static const uint16_t Font11x18 [] = {
 0x3800, 0x3C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0E00, 0x0700, 0x0700, 0x0E00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x3C00, 0x3800,   // }
 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3880, 0x7F80, 0x4700, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // ~
 };
+#endif
 
+#if defined(SSD1309_INCLUDE_FONT_16x26)
 static const uint16_t Font16x26 [] = {
 0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000, // Ascii = [ ]
 0x03E0,0x03E0,0x03E0,0x03E0,0x03E0,0x03E0,0x03E0,0x03E0,0x03C0,0x03C0,0x01C0,0x01C0,0x01C0,0x01C0,0x01C0,0x0000,0x0000,0x0000,0x03E0,0x03E0,0x03E0,0x0000,0x0000,0x0000,0x0000,0x0000, // Ascii = [!]
@@ -293,6 +300,7 @@ static const uint16_t Font16x26 [] = {
 0x3FC0,0x03E0,0x01E0,0x01E0,0x01E0,0x01E0,0x01C0,0x03C0,0x03C0,0x01C0,0x01E0,0x00FE,0x00FE,0x01E0,0x01C0,0x03C0,0x03C0,0x01C0,0x01E0,0x01E0,0x01E0,0x01E0,0x03E0,0x3FC0,0x3F00,0x0000, // Ascii = [}]
 0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3F07,0x7FC7,0x73E7,0xF1FF,0xF07E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000, // Ascii = [~]
 };
+#endif
 
 
 static const uint16_t Pwr[]         = {0x1F00, 0x2480, 0x4440, 0x8420, 0x8420, 0x8020, 0x8020, 0x8020, 0x4040, 0x2080, 0x1F00};
@@ -306,9 +314,15 @@ static const uint16_t Bluetooth[]   = {0x0000, 0x2000, 0x3000, 0x2800, 0x7000, 0
 static const uint16_t Down[]        = {0x0000, 0x0000, 0x0000, 0xFE00, 0x7C00, 0x3800, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000};
 static const uint16_t Up[]          = {0x0000, 0x0000, 0x0000, 0x1000, 0x3800, 0x7C00, 0xFE00, 0x0000, 0x0000, 0x0000, 0x0000};
 
-FontDef Font_7x10 = {FONT_7x10_ID, 7, 10, Font7x10};
-FontDef Font_11x18 = {FONT_11x18_ID, 11, 18, Font11x18};
-FontDef Font_16x26 = {FONT_16x26_ID, 16, 26, Font16x26};
+#if defined(SSD1309_INCLUDE_FONT_7x10)
+FontDef Font_7x10 = {FONT_7x10_ID, 7, 10, Font7x10, Font7x10Pages};
+#endif
+#if defined(SSD1309_INCLUDE_FONT_11x18)
+FontDef Font_11x18 = {FONT_11x18_ID, 11, 18, Font11x18, Font11x18Pages};
+#endif
+#if defined(SSD1309_INCLUDE_FONT_16x26)
+FontDef Font_16x26 = {FONT_16x26_ID, 16, 26, Font16x26, Font16x26Pages};
+#endif
 
 SymbolDef SSD1309_Symbol[ALL_SYMBOL] = { 
                                       {POWER, 11, 11, Pwr},
@@ -1,8 +1,11 @@
+#include <stddef.h>
 #include <stdint.h>
 
 #ifndef __SSD1309_FONTS_H__
 #define __SSD1309_FONTS_H__
 
+#include "ssd1309_conf.h"
+
 #define FONT_7x10_ID      0x00
 #define FONT_11x18_ID     0x01
 #define FONT_16x26_ID     0x02
@@ -39,11 +42,54 @@ typedef struct
 	const uint8_t FontWidth;    /*!< Font width in pixels */
 	uint8_t FontHeight;	    /*!< Font height in pixels */
 	const uint16_t *data;	    /*!< Pointer to data font data array */
+	const uint8_t *pages;	    /*!< Page-major copy of data (tools/fontconv.py), NULL if none */
 } FontDef;
 
+/* Glyph of a proportional font, its bitmap trimmed to the inked box */
+typedef struct
+{
+	uint16_t Offset;	    /*!< Compressed bitmap in the Bitmaps of the font */
+	uint8_t Width;		    /*!< Inked box in pixels, 0 for blank glyphs */
+	uint8_t Height;
+	int8_t XOffset;		    /*!< Box position from the pen */
+	int8_t YOffset;		    /*!< Box position from the top of the line */
+	uint8_t Advance;	    /*!< Pen move to the next glyph */
+} SSD1309_Glyph_t;
+
+/* Proportional font, glyph bitmaps page-major and run-length coded: */
+/*   0x00-0x7F  n + 1 literal bytes follow                           */
+/*   0x80-0xBF  the next byte repeated n - 0x80 + 2 times            */
+/*   0xC0-0xFF  n - 0xC0 + 1 zero bytes                              */
+/* Generated by tools/fontgen.py                                     */
+typedef struct
+{
+	uint8_t Height;		    /*!< Line height in pixels */
+	uint16_t First;		    /*!< Code point of Glyphs[0] */
+	uint16_t Count;
+	const SSD1309_Glyph_t *Glyphs;
+	const uint8_t *Bitmaps;
+	const uint16_t *Codepoints; /*!< Sorted code points of the Glyphs, NULL if they run on from First */
+} SSD1309_Font_t;
+
+#if defined(SSD1309_INCLUDE_FONT_7x10)
 extern FontDef Font_7x10;
+#endif
+#if defined(SSD1309_INCLUDE_FONT_11x18)
 extern FontDef Font_11x18;
+#endif
+#if defined(SSD1309_INCLUDE_FONT_16x26)
 extern FontDef Font_16x26;
+#endif
+
+#if defined(SSD1309_INCLUDE_FONT_7x10)
+extern const SSD1309_Font_t FontProp_7x10;
+#endif
+#if defined(SSD1309_INCLUDE_FONT_11x18)
+extern const SSD1309_Font_t FontProp_11x18;
+#endif
+#if defined(SSD1309_INCLUDE_FONT_16x26)
+extern const SSD1309_Font_t FontProp_16x26;
+#endif
 
 extern SymbolDef SSD1309_Symbol[];
 
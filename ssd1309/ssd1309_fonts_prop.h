@@ -0,0 +1,624 @@
+/* Generated by tools/fontgen.py, do not edit */
+
+#ifndef __SSD1309_FONTS_PROP_H__
+#define __SSD1309_FONTS_PROP_H__
+
+#if defined(SSD1309_INCLUDE_FONT_7x10)
+/* FontProp_7x10: 110 glyphs, 610 bytes of bitmaps */
+static const uint8_t FontProp_7x10Bitmaps [] = {
+0x00, 0xBF, 0x02, 0x07, 0x00, 0x07, 0x04, 0xF4, 0x2F, 0x24, 0xF4, 0x2F, 0x04, 0x66, 0x89, 0xFF,
+0x89, 0x72, 0xC1, 0x00, 0x01, 0xC1, 0x04, 0x26, 0x19, 0x6E, 0x94, 0x62, 0x04, 0x60, 0x96, 0x99,
+0x66, 0x90, 0x00, 0x07, 0x05, 0xFC, 0x02, 0x01, 0x00, 0x01, 0x02, 0x05, 0x01, 0x02, 0xFC, 0x02,
+0x01, 0x00, 0x02, 0x0A, 0x07, 0x0A, 0x04, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x00, 0x07, 0x81, 0x01,
+0x00, 0x01, 0x02, 0xC0, 0x3C, 0x03, 0x04, 0x7E, 0x81, 0x89, 0x81, 0x7E, 0x02, 0x04, 0x02, 0xFF,
+0x04, 0x86, 0xC1, 0xA1, 0x91, 0x8E, 0x04, 0x42, 0x81, 0x89, 0x89, 0x76, 0x04, 0x30, 0x2C, 0x22,
+0xFF, 0x20, 0x00, 0x4F, 0x81, 0x89, 0x00, 0x71, 0x00, 0x7E, 0x81, 0x89, 0x00, 0x72, 0x04, 0x01,
+0xE1, 0x19, 0x05, 0x03, 0x00, 0x76, 0x81, 0x89, 0x00, 0x76, 0x00, 0x4E, 0x81, 0x91, 0x00, 0x7E,
+0x00, 0x21, 0x00, 0x71, 0x04, 0x04, 0x0A, 0x0A, 0x11, 0x11, 0x83, 0x05, 0x04, 0x11, 0x11, 0x0A,
+0x0A, 0x04, 0x04, 0x02, 0x01, 0xB1, 0x09, 0x06, 0x04, 0x7E, 0x81, 0x99, 0x95, 0x1E, 0x04, 0xE0,
+0x3E, 0x21, 0x3E, 0xE0, 0x00, 0xFF, 0x81, 0x89, 0x00, 0x76, 0x00, 0x7E, 0x81, 0x81, 0x00, 0x42,
+0x04, 0xFF, 0x81, 0x81, 0x42, 0x3C, 0x00, 0xFF, 0x82, 0x89, 0x00, 0xFF, 0x81, 0x09, 0x00, 0x01,
+0x04, 0x7E, 0x81, 0x91, 0x91, 0x72, 0x00, 0xFF, 0x81, 0x08, 0x00, 0xFF, 0x02, 0x81, 0xFF, 0x81,
+0x00, 0x40, 0x81, 0x80, 0x00, 0x7F, 0x04, 0xFF, 0x08, 0x14, 0x62, 0x81, 0x00, 0xFF, 0x82, 0x80,
+0x04, 0xFF, 0x06, 0x08, 0x06, 0xFF, 0x04, 0xFF, 0x06, 0x18, 0x60, 0xFF, 0x00, 0x7E, 0x81, 0x81,
+0x00, 0x7E, 0x00, 0xFF, 0x81, 0x11, 0x00, 0x0E, 0x04, 0x7E, 0x81, 0xC1, 0x81, 0x7E, 0xC3, 0x00,
+0x01, 0x04, 0xFF, 0x11, 0x11, 0x71, 0x8E, 0x04, 0x46, 0x89, 0x89, 0x91, 0x62, 0x04, 0x01, 0x01,
+0xFF, 0x01, 0x01, 0x00, 0x7F, 0x81, 0x80, 0x00, 0x7F, 0x04, 0x07, 0x38, 0xC0, 0x38, 0x07, 0x04,
+0x3F, 0xE0, 0x1C, 0xE0, 0x3F, 0x04, 0x81, 0x66, 0x18, 0x66, 0x81, 0x04, 0x03, 0x0C, 0xF0, 0x0C,
+0x03, 0x04, 0xC1, 0xA1, 0x99, 0x85, 0x83, 0x03, 0xFF, 0x01, 0x03, 0x02, 0x02, 0x03, 0x3C, 0xC0,
+0x03, 0x01, 0xFF, 0x02, 0x03, 0x04, 0x08, 0x06, 0x01, 0x06, 0x08, 0x85, 0x01, 0x01, 0x01, 0x02,
+0x04, 0x1A, 0x25, 0x25, 0x15, 0x3E, 0x04, 0xFF, 0x48, 0x84, 0x84, 0x78, 0x00, 0x1E, 0x81, 0x21,
+0x00, 0x12, 0x04, 0x78, 0x84, 0x84, 0x48, 0xFF, 0x00, 0x1E, 0x81, 0x25, 0x00, 0x16, 0x04, 0x04,
+0x04, 0xFE, 0x05, 0x05, 0x04, 0x9E, 0xA1, 0xA1, 0x92, 0x7F, 0x04, 0xFF, 0x08, 0x04, 0x04, 0xF8,
+0x02, 0x04, 0x04, 0xFD, 0x03, 0x00, 0x04, 0x04, 0xFD, 0x81, 0x02, 0x00, 0x01, 0x04, 0xFF, 0x10,
+0x28, 0x44, 0x80, 0x02, 0x01, 0x01, 0xFF, 0x04, 0x3F, 0x01, 0x3F, 0x01, 0x3E, 0x04, 0x3F, 0x02,
+0x01, 0x01, 0x3E, 0x00, 0x1E, 0x81, 0x21, 0x00, 0x1E, 0x04, 0xFF, 0x12, 0x21, 0x21, 0x1E, 0x04,
+0x1E, 0x21, 0x21, 0x12, 0xFF, 0x04, 0x3F, 0x02, 0x01, 0x01, 0x02, 0x04, 0x12, 0x25, 0x25, 0x29,
+0x12, 0x03, 0x04, 0x7F, 0x84, 0x84, 0x04, 0x1F, 0x20, 0x20, 0x10, 0x3F, 0x04, 0x03, 0x1C, 0x20,
+0x1C, 0x03, 0x04, 0x0F, 0x38, 0x07, 0x38, 0x0F, 0x04, 0x21, 0x12, 0x0C, 0x12, 0x21, 0x04, 0x83,
+0x8C, 0x70, 0x0C, 0x03, 0x04, 0x31, 0x29, 0x25, 0x23, 0x21, 0x05, 0x30, 0xCF, 0x01, 0x00, 0x03,
+0x02, 0x01, 0xFF, 0x03, 0x05, 0x01, 0xCF, 0x30, 0x02, 0x03, 0x00, 0x04, 0x03, 0x01, 0x01, 0x02,
+0x03, 0x03, 0x06, 0x09, 0x09, 0x06, 0x04, 0xFF, 0x20, 0x20, 0x10, 0x3F, 0x04, 0x68, 0x95, 0x94,
+0x55, 0xF8, 0x04, 0x78, 0x94, 0x96, 0x95, 0x58, 0x04, 0x78, 0x85, 0x84, 0x85, 0x78, 0x04, 0x7C,
+0x81, 0x80, 0x41, 0xFC, 0x06, 0xC0, 0x60, 0x5E, 0x41, 0x41, 0xFF, 0x01, 0xC3, 0x00, 0x01, 0x06,
+0xE3, 0x14, 0x08, 0xFF, 0x08, 0x14, 0xE3, 0x05, 0x80, 0x40, 0x3E, 0x01, 0x01, 0xFF, 0x00, 0xFF,
+0x81, 0x01, 0x00, 0xFF, 0x04, 0xC6, 0x29, 0x19, 0x09, 0xFF, 0x02, 0x04, 0x0E, 0x15, 0x81, 0x04,
+0x04, 0x04, 0x02, 0xFF, 0x02, 0x04, 0x81, 0x04, 0x02, 0x15, 0x0E, 0x04, 0x04, 0x20, 0x40, 0xFF,
+0x40, 0x20,
+};
+
+static const SSD1309_Glyph_t FontProp_7x10Glyphs [] = {
+    {    0,  0,  0,  0,  0,  4},  // sp
+    {    0,  1,  8,  0,  0,  2},  // !
+    {    2,  3,  3,  0,  0,  4},  // "
+    {    6,  5,  8,  0,  0,  6},  // #
+    {   12,  5,  9,  0,  0,  6},  // $
+    {   22,  5,  8,  0,  0,  6},  // %
+    {   28,  5,  8,  0,  0,  6},  // &
+    {   34,  1,  3,  0,  0,  2},  // '
+    {   36,  3, 10,  0,  0,  4},  // (
+    {   43,  3, 10,  0,  0,  4},  // )
+    {   50,  3,  4,  0,  0,  4},  // *
+    {   54,  5,  5,  0,  2,  6},  // +
+    {   60,  1,  3,  0,  7,  2},  // ,
+    {   62,  3,  1,  0,  5,  4},  // -
+    {   64,  1,  1,  0,  7,  2},  // .
+    {   66,  3,  8,  0,  0,  4},  // /
+    {   70,  5,  8,  0,  0,  6},  // 0
+    {   76,  3,  8,  0,  0,  4},  // 1
+    {   80,  5,  8,  0,  0,  6},  // 2
+    {   86,  5,  8,  0,  0,  6},  // 3
+    {   92,  5,  8,  0,  0,  6},  // 4
+    {   98,  5,  8,  0,  0,  6},  // 5
+    {  104,  5,  8,  0,  0,  6},  // 6
+    {  110,  5,  8,  0,  0,  6},  // 7
+    {  116,  5,  8,  0,  0,  6},  // 8
+    {  122,  5,  8,  0,  0,  6},  // 9
+    {  128,  1,  6,  0,  2,  2},  // :
+    {  130,  1,  7,  0,  3,  2},  // ;
+    {  132,  5,  5,  0,  2,  6},  // <
+    {  138,  5,  3,  0,  3,  6},  // =
+    {  140,  5,  5,  0,  2,  6},  // >
+    {  146,  5,  8,  0,  0,  6},  // ?
+    {  152,  5,  8,  0,  0,  6},  // @
+    {  158,  5,  8,  0,  0,  6},  // A
+    {  164,  5,  8,  0,  0,  6},  // B
+    {  170,  5,  8,  0,  0,  6},  // C
+    {  176,  5,  8,  0,  0,  6},  // D
+    {  182,  5,  8,  0,  0,  6},  // E
+    {  186,  5,  8,  0,  0,  6},  // F
+    {  192,  5,  8,  0,  0,  6},  // G
+    {  198,  5,  8,  0,  0,  6},  // H
+    {  204,  3,  8,  0,  0,  4},  // I
+    {  208,  5,  8,  0,  0,  6},  // J
+    {  214,  5,  8,  0,  0,  6},  // K
+    {  220,  5,  8,  0,  0,  6},  // L
+    {  224,  5,  8,  0,  0,  6},  // M
+    {  230,  5,  8,  0,  0,  6},  // N
+    {  236,  5,  8,  0,  0,  6},  // O
+    {  242,  5,  8,  0,  0,  6},  // P
+    {  248,  5,  9,  0,  0,  6},  // Q
+    {  257,  5,  8,  0,  0,  6},  // R
+    {  263,  5,  8,  0,  0,  6},  // S
+    {  269,  5,  8,  0,  0,  6},  // T
+    {  275,  5,  8,  0,  0,  6},  // U
+    {  281,  5,  8,  0,  0,  6},  // V
+    {  287,  5,  8,  0,  0,  6},  // W
+    {  293,  5,  8,  0,  0,  6},  // X
+    {  299,  5,  8,  0,  0,  6},  // Y
+    {  305,  5,  8,  0,  0,  6},  // Z
+    {  311,  2, 10,  0,  0,  3},  // [
+    {  316,  3,  8,  0,  0,  4},  /* \ */
+    {  320,  2, 10,  0,  0,  3},  // ]
+    {  325,  5,  4,  0,  0,  6},  // ^
+    {  331,  7,  1,  0,  9,  8},  // _
+    {  333,  2,  2,  0,  0,  3},  // `
+    {  336,  5,  6,  0,  2,  6},  // a
+    {  342,  5,  8,  0,  0,  6},  // b
+    {  348,  5,  6,  0,  2,  6},  // c
+    {  354,  5,  8,  0,  0,  6},  // d
+    {  360,  5,  6,  0,  2,  6},  // e
+    {  366,  5,  8,  0,  0,  6},  // f
+    {  372,  5,  8,  0,  2,  6},  // g
+    {  378,  5,  8,  0,  0,  6},  // h
+    {  384,  3,  8,  0,  0,  4},  // i
+    {  388,  4, 10,  0,  0,  5},  // j
+    {  397,  5,  8,  0,  0,  6},  // k
+    {  403,  3,  8,  0,  0,  4},  // l
+    {  407,  5,  6,  0,  2,  6},  // m
+    {  413,  5,  6,  0,  2,  6},  // n
+    {  419,  5,  6,  0,  2,  6},  // o
+    {  425,  5,  8,  0,  2,  6},  // p
+    {  431,  5,  8,  0,  2,  6},  // q
+    {  437,  5,  6,  0,  2,  6},  // r
+    {  443,  5,  6,  0,  2,  6},  // s
+    {  449,  4,  8,  0,  0,  5},  // t
+    {  454,  5,  6,  0,  2,  6},  // u
+    {  460,  5,  6,  0,  2,  6},  // v
+    {  466,  5,  6,  0,  2,  6},  // w
+    {  472,  5,  6,  0,  2,  6},  // x
+    {  478,  5,  8,  0,  2,  6},  // y
+    {  484,  5,  6,  0,  2,  6},  // z
+    {  490,  3, 10,  0,  0,  4},  // {
+    {  497,  1, 10,  0,  0,  2},  // |
+    {  500,  3, 10,  0,  0,  4},  // }
+    {  507,  5,  2,  0,  3,  6},  // ~
+    {  513,  4,  4,  0,  0,  5},  // U+00B0 °
+    {  518,  5,  8,  0,  2,  6},  // U+00B5 µ
+    {  524,  5,  8,  0,  0,  6},  // U+00E4 ä
+    {  530,  5,  8,  0,  0,  6},  // U+00E9 é
+    {  536,  5,  8,  0,  0,  6},  // U+00F6 ö
+    {  542,  5,  8,  0,  0,  6},  // U+00FC ü
+    {  548,  6,  9,  0,  0,  7},  // U+0414 Д
+    {  559,  7,  8,  0,  0,  8},  // U+0416 Ж
+    {  567,  6,  8,  0,  0,  7},  // U+041B Л
+    {  574,  5,  8,  0,  0,  6},  // U+041F П
+    {  580,  5,  8,  0,  0,  6},  // U+042F Я
+    {  586,  6,  5,  0,  2,  7},  // U+2190 ←
+    {  592,  5,  8,  0,  0,  6},  // U+2191 ↑
+    {  598,  6,  5,  0,  2,  7},  // U+2192 →
+    {  604,  5,  8,  0,  0,  6},  // U+2193 ↓
+};
+
+static const uint16_t FontProp_7x10Codepoints [] = {
+0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B,
+0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043,
+0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B,
+0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x00B0,
+0x00B5, 0x00E4, 0x00E9, 0x00F6, 0x00FC, 0x0414, 0x0416, 0x041B, 0x041F, 0x042F, 0x2190, 0x2191,
+0x2192, 0x2193,
+};
+
+const SSD1309_Font_t FontProp_7x10 = {10, 0x0020, 110, FontProp_7x10Glyphs, FontProp_7x10Bitmaps, FontProp_7x10Codepoints};
+#endif
+
+#if defined(SSD1309_INCLUDE_FONT_11x18)
+/* FontProp_11x18: 95 glyphs, 1285 bytes of bitmaps */
+static const uint8_t FontProp_11x18Bitmaps [] = {
+0x03, 0xFF, 0xFF, 0x37, 0x37, 0x04, 0x1F, 0x1F, 0x00, 0x1F, 0x1F, 0x11, 0x30, 0xB0, 0xFF, 0x7F,
+0x30, 0xB0, 0xFF, 0x7F, 0x30, 0x03, 0x3F, 0x3F, 0x03, 0x03, 0x3F, 0x3F, 0x03, 0x03, 0x0F, 0x1C,
+0x3E, 0x77, 0x63, 0xFF, 0xC3, 0x8E, 0x0C, 0x0E, 0x1E, 0x38, 0x30, 0xFF, 0x30, 0x1F, 0x0F, 0x13,
+0x1E, 0x3F, 0x21, 0x3F, 0x9E, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x00, 0x0C, 0x06, 0x03, 0x01, 0x1E,
+0x3F, 0x21, 0x3F, 0x1E, 0x11, 0x00, 0x9E, 0xBF, 0xE3, 0xE3, 0x3F, 0x1E, 0x80, 0x80, 0x0F, 0x1F,
+0x30, 0x30, 0x31, 0x1B, 0x0E, 0x3F, 0x11, 0x01, 0x1F, 0x1F, 0x08, 0xC0, 0xF8, 0x1C, 0x06, 0x01,
+0x0F, 0x7F, 0xE0, 0x80, 0xC3, 0x01, 0x01, 0x02, 0x0B, 0x01, 0x06, 0x1C, 0xF8, 0xC0, 0x00, 0x80,
+0xE0, 0x7F, 0x0F, 0x02, 0x01, 0xC2, 0x05, 0x16, 0x1C, 0x0F, 0x0F, 0x1C, 0x16, 0x82, 0x30, 0x01,
+0xFF, 0xFF, 0x82, 0x30, 0xC3, 0x01, 0x03, 0x03, 0xC3, 0x01, 0x13, 0x0F, 0x82, 0x03, 0x01, 0x03,
+0x03, 0x07, 0x00, 0x80, 0xF8, 0x7F, 0x07, 0x38, 0x3F, 0x07, 0xC1, 0x0F, 0xF8, 0xFE, 0x07, 0xC3,
+0xC3, 0x07, 0xFE, 0xF8, 0x07, 0x1F, 0x38, 0x30, 0x30, 0x38, 0x1F, 0x07, 0x04, 0x18, 0x0C, 0x06,
+0xFF, 0xFF, 0xC2, 0x01, 0x3F, 0x3F, 0x0C, 0x1C, 0x1E, 0x07, 0x03, 0x83, 0xC7, 0x7E, 0x3C, 0x38,
+0x3C, 0x36, 0x33, 0x31, 0x81, 0x30, 0x0F, 0x0C, 0x0E, 0x03, 0x63, 0x63, 0xFE, 0x9C, 0x00, 0x0C,
+0x1C, 0x38, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0x05, 0x00, 0xC0, 0xF8, 0x1E, 0xFF, 0xFF, 0xC1, 0x07,
+0x07, 0x07, 0x06, 0x06, 0x3F, 0x3F, 0x06, 0x06, 0x0F, 0xFF, 0xFF, 0x43, 0x63, 0x63, 0xE3, 0xC3,
+0x80, 0x0C, 0x1C, 0x38, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0x0F, 0xF8, 0xFE, 0xC7, 0x63, 0x63, 0xE7,
+0xCE, 0x8C, 0x07, 0x1F, 0x38, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0x81, 0x03, 0x04, 0x83, 0xE3, 0x7B,
+0x1F, 0x07, 0xC1, 0x02, 0x38, 0x3F, 0x03, 0xC2, 0x01, 0x1C, 0xBE, 0x81, 0xC3, 0x04, 0xC7, 0xBE,
+0x1C, 0x0F, 0x1F, 0x82, 0x30, 0x01, 0x1F, 0x0F, 0x0F, 0x7C, 0xFE, 0xC7, 0x83, 0x83, 0xC7, 0xFE,
+0xF8, 0x0C, 0x1C, 0x39, 0x31, 0x31, 0x38, 0x1F, 0x07, 0x82, 0x03, 0x03, 0x83, 0x83, 0x09, 0x07,
+0x07, 0x10, 0x38, 0x28, 0x6C, 0x44, 0xC6, 0x82, 0x83, 0xC6, 0x00, 0x01, 0x86, 0x33, 0x08, 0x83,
+0x82, 0xC6, 0x44, 0x6C, 0x28, 0x38, 0x10, 0x01, 0xC6, 0x08, 0x0C, 0x0E, 0x07, 0x03, 0x83, 0xC3,
+0xE7, 0x7E, 0x3C, 0xC2, 0x02, 0x37, 0x37, 0x01, 0xC2, 0x0F, 0xF8, 0xFE, 0x0F, 0xE3, 0xE3, 0x33,
+0xFE, 0xFC, 0x07, 0x1F, 0x38, 0x31, 0x33, 0x1B, 0x03, 0x03, 0x0B, 0x00, 0xC0, 0xFC, 0x3F, 0x03,
+0x3F, 0xFC, 0xC0, 0x00, 0x38, 0x3F, 0x07, 0x81, 0x03, 0x02, 0x07, 0x3F, 0x38, 0x01, 0xFF, 0xFF,
+0x81, 0xC3, 0x04, 0xFE, 0x3C, 0x00, 0x3F, 0x3F, 0x81, 0x30, 0x02, 0x39, 0x1F, 0x0E, 0x02, 0xF8,
+0xFE, 0x07, 0x81, 0x03, 0x04, 0x0E, 0x0C, 0x07, 0x1F, 0x38, 0x81, 0x30, 0x01, 0x1C, 0x0C, 0x01,
+0xFF, 0xFF, 0x81, 0x03, 0x04, 0x0E, 0xFE, 0xF8, 0x3F, 0x3F, 0x81, 0x30, 0x02, 0x1C, 0x0F, 0x03,
+0x01, 0xFF, 0xFF, 0x83, 0xC3, 0x02, 0x03, 0x3F, 0x3F, 0x84, 0x30, 0x01, 0xFF, 0xFF, 0x83, 0xC3,
+0x02, 0x03, 0x3F, 0x3F, 0xC5, 0x0F, 0xF8, 0xFE, 0x07, 0x03, 0x03, 0x83, 0x8E, 0x8C, 0x07, 0x1F,
+0x38, 0x30, 0x30, 0x31, 0x1F, 0x1F, 0x01, 0xFF, 0xFF, 0x82, 0xC0, 0x03, 0xFF, 0xFF, 0x3F, 0x3F,
+0xC3, 0x01, 0x3F, 0x3F, 0x0B, 0x03, 0x03, 0xFF, 0xFF, 0x03, 0x03, 0x30, 0x30, 0x3F, 0x3F, 0x30,
+0x30, 0xC5, 0x09, 0xFF, 0xFF, 0x0E, 0x1E, 0x38, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0x0A, 0xFF, 0xFF,
+0xC0, 0xE0, 0xB8, 0x1C, 0x06, 0x03, 0x01, 0x3F, 0x3F, 0xC1, 0x04, 0x03, 0x07, 0x1C, 0x38, 0x20,
+0x01, 0xFF, 0xFF, 0xC5, 0x01, 0x3F, 0x3F, 0x84, 0x30, 0x0A, 0xFF, 0xFF, 0x0F, 0x7C, 0xC0, 0x7C,
+0x07, 0xFF, 0xFF, 0x3F, 0x3F, 0xC4, 0x01, 0x3F, 0x3F, 0x09, 0xFF, 0xFF, 0x1F, 0xFC, 0xE0, 0x00,
+0xFF, 0xFF, 0x3F, 0x3F, 0xC1, 0x03, 0x0F, 0x3E, 0x3F, 0x3F, 0x0F, 0xF8, 0xFE, 0x07, 0x03, 0x03,
+0x07, 0xFE, 0xF8, 0x07, 0x1F, 0x38, 0x30, 0x30, 0x38, 0x1F, 0x07, 0x01, 0xFF, 0xFF, 0x81, 0x83,
+0x04, 0xC7, 0xFE, 0x7C, 0x3F, 0x3F, 0x82, 0x01, 0xC1, 0x11, 0xF8, 0xFE, 0x07, 0x03, 0x03, 0x07,
+0xFE, 0xF8, 0x00, 0x07, 0x1F, 0x38, 0x30, 0x36, 0x3C, 0x1F, 0x17, 0x20, 0x01, 0xFF, 0xFF, 0x81,
+0xC3, 0x05, 0xE7, 0x7E, 0x3C, 0x00, 0x3F, 0x3F, 0xC1, 0x04, 0x01, 0x07, 0x1E, 0x38, 0x20, 0x0F,
+0x00, 0x3C, 0x7E, 0x63, 0xC3, 0xC3, 0x8E, 0x0C, 0x06, 0x1E, 0x38, 0x30, 0x30, 0x31, 0x1F, 0x0F,
+0x82, 0x03, 0x01, 0xFF, 0xFF, 0x82, 0x03, 0xC3, 0x01, 0x3F, 0x3F, 0xC3, 0x01, 0xFF, 0xFF, 0xC3,
+0x09, 0xFF, 0xFF, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0x08, 0x07, 0x3F, 0xF8, 0xC0,
+0x00, 0xC0, 0xF8, 0x3F, 0x07, 0xC1, 0x04, 0x03, 0x1F, 0x3C, 0x1F, 0x03, 0xC1, 0x01, 0x3F, 0xFF,
+0xC1, 0x01, 0xE0, 0xE0, 0xC1, 0x0B, 0xFF, 0x3F, 0x00, 0x3F, 0x38, 0x0F, 0x01, 0x01, 0x0F, 0x38,
+0x3F, 0x00, 0x13, 0x01, 0x07, 0x1E, 0x38, 0xF0, 0xE0, 0x38, 0x1C, 0x07, 0x01, 0x20, 0x38, 0x1C,
+0x0F, 0x07, 0x03, 0x07, 0x1E, 0x38, 0x20, 0x09, 0x01, 0x07, 0x1E, 0x78, 0xE0, 0xE0, 0x78, 0x1E,
+0x07, 0x01, 0xC3, 0x01, 0x3F, 0x3F, 0xC3, 0x0B, 0x00, 0x03, 0x03, 0xC3, 0xE3, 0x3B, 0x1F, 0x07,
+0x38, 0x3C, 0x37, 0x33, 0x82, 0x30, 0x05, 0xFF, 0xFF, 0x03, 0x03, 0xFF, 0xFF, 0xC1, 0x82, 0x03,
+0x03, 0x07, 0x7F, 0xF8, 0x80, 0xC2, 0x02, 0x07, 0x3F, 0x38, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xC1,
+0x01, 0xFF, 0xFF, 0x82, 0x03, 0x07, 0xC0, 0xF0, 0x3C, 0x07, 0x07, 0x3C, 0xF0, 0xC0, 0x89, 0x01,
+0x03, 0x01, 0x03, 0x07, 0x04, 0x01, 0xC4, 0xE6, 0x81, 0x33, 0x04, 0xB3, 0xFF, 0xFE, 0x00, 0x01,
+0x81, 0x03, 0x81, 0x01, 0x01, 0x03, 0x02, 0x0F, 0xFF, 0xFF, 0x60, 0x30, 0x30, 0x70, 0xE0, 0xC0,
+0x3F, 0x3F, 0x18, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0x09, 0xFC, 0xFE, 0x87, 0x03, 0x03, 0x87, 0xCE,
+0xCC, 0x00, 0x01, 0x82, 0x03, 0x01, 0x01, 0x00, 0x0F, 0xC0, 0xE0, 0x70, 0x30, 0x30, 0x60, 0xFF,
+0xFF, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x18, 0x3F, 0x3F, 0x09, 0xFC, 0xFE, 0xB7, 0x33, 0x33, 0x37,
+0xBE, 0xB8, 0x00, 0x01, 0x82, 0x03, 0x01, 0x01, 0x00, 0x81, 0x30, 0x01, 0xFE, 0xFF, 0x81, 0x33,
+0x00, 0x03, 0xC2, 0x01, 0x3F, 0x3F, 0xC3, 0x09, 0xFC, 0xFE, 0x87, 0x03, 0x03, 0x86, 0xFF, 0xFF,
+0x18, 0x39, 0x81, 0x33, 0x02, 0x39, 0x1F, 0x0F, 0x02, 0xFF, 0xFF, 0x60, 0x81, 0x30, 0x03, 0xF0,
+0xE0, 0x3F, 0x3F, 0xC3, 0x01, 0x3F, 0x3F, 0x81, 0x30, 0x01, 0xF3, 0xF3, 0xC2, 0x01, 0x3F, 0x3F,
+0x00, 0x00, 0x81, 0x30, 0x02, 0xF3, 0xF3, 0x80, 0xC2, 0x02, 0xFF, 0xFF, 0x01, 0x82, 0x03, 0x00,
+0x01, 0x11, 0xFF, 0xFF, 0x00, 0x80, 0xC0, 0x60, 0x30, 0x10, 0x00, 0x3F, 0x3F, 0x03, 0x01, 0x03,
+0x0E, 0x1C, 0x30, 0x20, 0x81, 0x03, 0x01, 0xFF, 0xFF, 0xC2, 0x01, 0x3F, 0x3F, 0x0B, 0xFF, 0xFF,
+0x02, 0x03, 0xFF, 0xFF, 0x06, 0x03, 0xFF, 0xFE, 0x03, 0x03, 0xC1, 0x01, 0x03, 0x03, 0xC1, 0x01,
+0x03, 0x03, 0x02, 0xFF, 0xFF, 0x06, 0x81, 0x03, 0x03, 0xFF, 0xFE, 0x03, 0x03, 0xC3, 0x01, 0x03,
+0x03, 0x09, 0xFC, 0xFE, 0x87, 0x03, 0x03, 0x87, 0xFE, 0xFC, 0x00, 0x01, 0x82, 0x03, 0x01, 0x01,
+0x00, 0x0A, 0xFF, 0xFF, 0x86, 0x03, 0x03, 0x87, 0xFE, 0xFC, 0x3F, 0x3F, 0x01, 0x81, 0x03, 0x01,
+0x01, 0x00, 0x09, 0xFC, 0xFE, 0x87, 0x03, 0x03, 0x86, 0xFF, 0xFF, 0x00, 0x01, 0x81, 0x03, 0x02,
+0x01, 0x3F, 0x3F, 0x0A, 0x01, 0xFF, 0xFE, 0x06, 0x03, 0x03, 0x07, 0x02, 0x00, 0x03, 0x03, 0xC4,
+0x01, 0x9C, 0xBE, 0x82, 0x33, 0x03, 0xF6, 0xE6, 0x01, 0x01, 0x82, 0x03, 0x01, 0x01, 0x00, 0x03,
+0x18, 0x18, 0xFE, 0xFF, 0x81, 0x18, 0xC2, 0x01, 0x0F, 0x1F, 0x82, 0x18, 0x01, 0xFF, 0xFF, 0xC2,
+0x03, 0x80, 0xFF, 0xFF, 0x01, 0x82, 0x03, 0x02, 0x01, 0x03, 0x03, 0x08, 0x01, 0x0F, 0x7E, 0xF0,
+0x80, 0xF0, 0x7E, 0x0F, 0x01, 0xC2, 0x02, 0x01, 0x03, 0x03, 0xC2, 0x08, 0x07, 0xFF, 0xC0, 0xFF,
+0x07, 0xFF, 0xC0, 0xFF, 0x07, 0xC1, 0x00, 0x03, 0xC2, 0x00, 0x03, 0xC1, 0x0A, 0x01, 0x87, 0xCE,
+0x78, 0x78, 0xCE, 0x87, 0x01, 0x02, 0x03, 0x01, 0xC1, 0x02, 0x01, 0x03, 0x02, 0x0D, 0x03, 0x1F,
+0xFC, 0xE0, 0x00, 0xF8, 0xFF, 0x07, 0x30, 0x30, 0x38, 0x1F, 0x1F, 0x07, 0xC1, 0x07, 0x03, 0x83,
+0xC3, 0x63, 0x33, 0x1B, 0x0F, 0x07, 0x88, 0x03, 0x03, 0x00, 0x80, 0xFE, 0xFF, 0x81, 0x03, 0x02,
+0x07, 0xFF, 0xFC, 0xC3, 0x00, 0x01, 0x81, 0x03, 0x82, 0xFF, 0x01, 0x03, 0x03, 0x04, 0x03, 0x03,
+0xFF, 0xFE, 0x80, 0xC2, 0x02, 0xFC, 0xFF, 0x07, 0x82, 0x03, 0x00, 0x01, 0xC1, 0x00, 0x06, 0x81,
+0x03, 0x81, 0x06, 0x00, 0x03,
+};
+
+static const SSD1309_Glyph_t FontProp_11x18Glyphs [] = {
+    {    0,  0,  0,  0,  0,  6},  // sp
+    {    0,  2, 14,  0,  1,  3},  // !
+    {    5,  5,  5,  0,  1,  6},  // "
+    {   11,  9, 14,  0,  1, 10},  // #
+    {   30,  8, 16,  0,  1,  9},  // $
+    {   47, 10, 14,  0,  1, 11},  // %
+    {   68,  9, 14,  0,  1, 10},  // &
+    {   87,  2,  5,  0,  1,  3},  // '
+    {   90,  5, 18,  0,  0,  6},  // (
+    {  104,  5, 18,  0,  0,  6},  // )
+    {  118,  6,  5,  0,  1,  7},  // *
+    {  125, 10, 10,  0,  3, 11},  // +
+    {  137,  2,  5,  0, 13,  3},  // ,
+    {  140,  4,  2,  0,  9,  5},  // -
+    {  142,  2,  2,  0, 13,  3},  // .
+    {  145,  5, 14,  0,  1,  6},  // /
+    {  155,  8, 14,  0,  1,  9},  // 0
+    {  172,  5, 14,  0,  1,  6},  // 1
+    {  182,  8, 14,  0,  1,  9},  // 2
+    {  198,  8, 14,  0,  1,  9},  // 3
+    {  215,  8, 14,  0,  1,  9},  // 4
+    {  232,  8, 14,  0,  1,  9},  // 5
+    {  249,  8, 14,  0,  1,  9},  // 6
+    {  266,  8, 14,  0,  1,  9},  // 7
+    {  280,  8, 14,  0,  1,  9},  // 8
+    {  296,  8, 14,  0,  1,  9},  // 9
+    {  313,  2, 10,  0,  5,  3},  // :
+    {  315,  2, 12,  0,  6,  3},  // ;
+    {  320,  8,  9,  0,  4,  9},  // <
+    {  332,  8,  6,  0,  5,  9},  // =
+    {  334,  8,  9,  0,  4,  9},  // >
+    {  345,  9, 14,  0,  1, 10},  // ?
+    {  361,  8, 14,  0,  1,  9},  // @
+    {  378,  9, 14,  0,  1, 10},  // A
+    {  397,  8, 14,  0,  1,  9},  // B
+    {  414,  8, 14,  0,  1,  9},  // C
+    {  431,  8, 14,  0,  1,  9},  // D
+    {  448,  8, 14,  0,  1,  9},  // E
+    {  459,  8, 14,  0,  1,  9},  // F
+    {  469,  8, 14,  0,  1,  9},  // G
+    {  486,  8, 14,  0,  1,  9},  // H
+    {  500,  6, 14,  0,  1,  7},  // I
+    {  513,  8, 14,  0,  1,  9},  // J
+    {  525,  9, 14,  0,  1, 10},  // K
+    {  544,  8, 14,  0,  1,  9},  // L
+    {  553,  9, 14,  0,  1, 10},  // M
+    {  569,  8, 14,  0,  1,  9},  // N
+    {  586,  8, 14,  0,  1,  9},  // O
+    {  603,  8, 14,  0,  1,  9},  // P
+    {  617,  9, 14,  0,  1, 10},  // Q
+    {  636,  9, 14,  0,  1, 10},  // R
+    {  655,  8, 14,  0,  1,  9},  // S
+    {  672, 10, 14,  0,  1, 11},  // T
+    {  684,  8, 14,  0,  1,  9},  // U
+    {  699,  9, 14,  0,  1, 10},  // V
+    {  717, 10, 14,  0,  1, 11},  // W
+    {  738, 10, 14,  0,  1, 11},  // X
+    {  759, 10, 14,  0,  1, 11},  // Y
+    {  775,  8, 14,  0,  1,  9},  // Z
+    {  790,  4, 18,  0,  0,  5},  // [
+    {  800,  5, 14,  0,  1,  6},  /* \ */
+    {  810,  4, 18,  0,  0,  5},  // ]
+    {  821,  8,  8,  0,  1,  9},  // ^
+    {  830, 11,  1,  0, 16, 12},  // _
+    {  832,  4,  3,  0,  1,  5},  // `
+    {  837,  9, 10,  0,  5, 10},  // a
+    {  855,  8, 14,  0,  1,  9},  // b
+    {  872,  8, 10,  0,  5,  9},  // c
+    {  888,  8, 14,  0,  1,  9},  // d
+    {  905,  8, 10,  0,  5,  9},  // e
+    {  921,  9, 14,  0,  1, 10},  // f
+    {  935,  8, 14,  0,  4,  9},  // g
+    {  952,  8, 14,  0,  1,  9},  // h
+    {  967,  5, 14,  0,  1,  6},  // i
+    {  976,  6, 18,  0,  0,  7},  // j
+    {  993,  9, 14,  0,  1, 10},  // k
+    { 1012,  5, 14,  0,  1,  6},  // l
+    { 1021, 10, 10,  0,  5, 11},  // m
+    { 1042,  8, 10,  0,  5,  9},  // n
+    { 1057,  8, 10,  0,  5,  9},  // o
+    { 1073,  8, 14,  0,  4,  9},  // p
+    { 1090,  8, 14,  0,  4,  9},  // q
+    { 1107,  8, 10,  0,  5,  9},  // r
+    { 1120,  8, 10,  0,  5,  9},  // s
+    { 1135,  8, 13,  0,  2,  9},  // t
+    { 1148,  8, 10,  0,  5,  9},  // u
+    { 1163,  9, 10,  0,  5, 10},  // v
+    { 1179,  9, 10,  0,  5, 10},  // w
+    { 1196,  8, 10,  0,  5,  9},  // x
+    { 1213,  8, 14,  0,  4,  9},  // y
+    { 1229,  9, 10,  0,  5, 10},  // z
+    { 1240,  6, 18,  0,  0,  7},  // {
+    { 1256,  2, 18,  0,  0,  3},  // |
+    { 1261,  6, 18,  0,  0,  7},  // }
+    { 1277,  8,  3,  0,  7,  9},  // ~
+};
+
+const SSD1309_Font_t FontProp_11x18 = {18, 0x0020, 95, FontProp_11x18Glyphs, FontProp_11x18Bitmaps, NULL};
+#endif
+
+#if defined(SSD1309_INCLUDE_FONT_16x26)
+/* FontProp_16x26: 95 glyphs, 2419 bytes of bitmaps */
+static const uint8_t FontProp_16x26Bitmaps [] = {
+0x83, 0xFF, 0x00, 0x03, 0x81, 0x7F, 0x00, 0x00, 0x83, 0x1C, 0x82, 0x7F, 0xC2, 0x82, 0x7F, 0x01,
+0x00, 0x80, 0x81, 0xC0, 0x0A, 0xE0, 0xFE, 0xFF, 0xFF, 0xC7, 0xC0, 0xFC, 0xFF, 0xFF, 0xCF, 0xC0,
+0x81, 0x60, 0x09, 0xE0, 0xFE, 0xFF, 0xFF, 0x6F, 0xE0, 0xFC, 0xFF, 0xFF, 0x7F, 0x81, 0x60, 0xC1,
+0x05, 0x1C, 0x1F, 0x1F, 0x0F, 0x00, 0x18, 0x81, 0x1F, 0x00, 0x01, 0xC3, 0x05, 0x00, 0xFC, 0xFE,
+0xFE, 0xFF, 0x87, 0x81, 0xFF, 0x03, 0x03, 0x07, 0x07, 0x06, 0xC1, 0x02, 0x01, 0x03, 0x07, 0x82,
+0xFF, 0x08, 0xFC, 0xF8, 0xF8, 0xF0, 0x0C, 0x0C, 0x1C, 0x1C, 0x18, 0x82, 0x7F, 0x03, 0x1F, 0x0F,
+0x0F, 0x07, 0x25, 0xFE, 0xFE, 0xFF, 0x03, 0x01, 0xCF, 0xFF, 0xFE, 0xFC, 0x80, 0xE0, 0xF0, 0xFC,
+0x3E, 0x1F, 0x07, 0x01, 0x01, 0x03, 0x83, 0xC2, 0xF3, 0xFB, 0x7F, 0xFF, 0xFF, 0xFB, 0xF9, 0x18,
+0x18, 0xF8, 0xF8, 0x18, 0x1C, 0x1F, 0x0F, 0x07, 0x01, 0xC1, 0x07, 0x07, 0x0F, 0x1F, 0x1F, 0x18,
+0x18, 0x1F, 0x1F, 0xC2, 0x01, 0x38, 0xFE, 0x81, 0xFF, 0x04, 0x83, 0xFF, 0xFF, 0xFE, 0x7E, 0xC2,
+0x15, 0xF8, 0xFC, 0xFC, 0xFE, 0x0F, 0x07, 0x1F, 0x3F, 0xFF, 0xFD, 0xF1, 0xE0, 0x80, 0xF0, 0xFC,
+0xFC, 0x03, 0x07, 0x0F, 0x1F, 0x1E, 0x1C, 0x81, 0x18, 0x02, 0x1D, 0x1F, 0x0F, 0x81, 0x1F, 0x00,
+0x1D, 0x00, 0x3F, 0x81, 0x7F, 0x00, 0x1F, 0x0B, 0x00, 0xE0, 0xF0, 0xFC, 0xFC, 0x3E, 0x0F, 0x07,
+0x03, 0x03, 0x01, 0x01, 0x82, 0xFF, 0x00, 0x81, 0xC7, 0x0A, 0x07, 0x0F, 0x3F, 0x3F, 0x7C, 0xF0,
+0xE0, 0xC0, 0xC0, 0x80, 0x80, 0xC7, 0x82, 0x01, 0x0A, 0x01, 0x01, 0x03, 0x03, 0x07, 0x0F, 0x3E,
+0xFC, 0xFC, 0xF0, 0xE0, 0xC7, 0x00, 0x81, 0x82, 0xFF, 0x0B, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xF0,
+0x7C, 0x3F, 0x3F, 0x0F, 0x07, 0x00, 0x82, 0x01, 0xC7, 0x81, 0x38, 0x06, 0x30, 0xF3, 0xFF, 0x1F,
+0xBF, 0xF1, 0xB0, 0x81, 0x38, 0x08, 0x30, 0x00, 0x04, 0x06, 0x0F, 0x0F, 0x07, 0x01, 0x03, 0x81,
+0x0F, 0x00, 0x04, 0xC1, 0x85, 0x80, 0x81, 0xFF, 0x84, 0x80, 0x85, 0x01, 0x81, 0x7F, 0x84, 0x01,
+0x00, 0x0F, 0x81, 0xFF, 0x00, 0x7F, 0x81, 0x01, 0xC1, 0x8B, 0x03, 0x83, 0x0F, 0xC8, 0x06, 0xC0,
+0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x03, 0xC4, 0x06, 0xC0, 0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x03, 0xC4,
+0x06, 0xC0, 0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x03, 0xC7, 0x82, 0x01, 0xCB, 0x0E, 0xE0, 0xF8, 0xFC,
+0xFE, 0x7F, 0x0F, 0x07, 0x03, 0x07, 0x0F, 0x7F, 0xFE, 0xFC, 0xF8, 0xE0, 0x82, 0xFF, 0x00, 0xC0,
+0xC4, 0x00, 0xC0, 0x82, 0xFF, 0x0E, 0x00, 0x03, 0x07, 0x0F, 0x1F, 0x1E, 0x1C, 0x18, 0x1C, 0x1E,
+0x1F, 0x0F, 0x07, 0x03, 0x00, 0x81, 0x0C, 0x02, 0x0E, 0x0E, 0xFE, 0x82, 0xFF, 0xC8, 0x83, 0xFF,
+0xC3, 0x83, 0x18, 0x83, 0x1F, 0x82, 0x18, 0x03, 0x06, 0x06, 0x07, 0x07, 0x81, 0x03, 0x05, 0x07,
+0xFF, 0xFE, 0xFE, 0xFC, 0x70, 0xC1, 0x0B, 0x80, 0xE0, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x07,
+0x03, 0x00, 0x1E, 0x81, 0x1F, 0x00, 0x1B, 0x86, 0x18, 0x02, 0x06, 0x07, 0x07, 0x81, 0x03, 0x06,
+0x07, 0xFF, 0xFF, 0xFE, 0xFC, 0x38, 0x00, 0x82, 0x06, 0x06, 0x07, 0x0F, 0x1F, 0xFF, 0xFD, 0xF8,
+0xF0, 0x81, 0x1C, 0x81, 0x18, 0x05, 0x1C, 0x1E, 0x0F, 0x0F, 0x07, 0x03, 0xC3, 0x04, 0x80, 0xE0,
+0xF0, 0xF8, 0x7E, 0x82, 0xFF, 0xC2, 0x08, 0x60, 0x78, 0x7C, 0x7F, 0x7F, 0x67, 0x63, 0x60, 0x60,
+0x82, 0xFF, 0x81, 0x60, 0xC8, 0x82, 0x1F, 0xC2, 0x82, 0xFF, 0x85, 0x07, 0x00, 0x00, 0x83, 0x03,
+0x06, 0x07, 0x0F, 0xBF, 0xFE, 0xFE, 0xFC, 0xF0, 0x81, 0x1C, 0x81, 0x18, 0x05, 0x1C, 0x1F, 0x0F,
+0x0F, 0x07, 0x01, 0x07, 0x00, 0xE0, 0xF8, 0xFC, 0xFE, 0x3E, 0x0F, 0x07, 0x81, 0x03, 0x04, 0x07,
+0x07, 0x06, 0x00, 0x0C, 0x82, 0xFF, 0x18, 0x0E, 0x07, 0x03, 0x03, 0x07, 0x0F, 0xFF, 0xFE, 0xFC,
+0xF8, 0x00, 0x01, 0x07, 0x0F, 0x0F, 0x1F, 0x1C, 0x18, 0x18, 0x1C, 0x1E, 0x0F, 0x0F, 0x07, 0x03,
+0x86, 0x07, 0x05, 0xC7, 0xF7, 0xFF, 0x7F, 0x3F, 0x0F, 0xC2, 0x07, 0x80, 0xE0, 0xF8, 0xFE, 0x7F,
+0x1F, 0x07, 0x01, 0xC3, 0x00, 0x18, 0x82, 0x1F, 0x00, 0x03, 0xC6, 0x2C, 0x00, 0x30, 0xFC, 0xFE,
+0xFF, 0xFF, 0x87, 0x03, 0x03, 0x87, 0xFF, 0xFF, 0xFE, 0x7C, 0x00, 0xC0, 0xF0, 0xF8, 0xFD, 0xFF,
+0x1F, 0x07, 0x0F, 0x0F, 0x1F, 0x7F, 0xFD, 0xF8, 0xF0, 0xE0, 0x01, 0x07, 0x0F, 0x0F, 0x1F, 0x1C,
+0x1C, 0x18, 0x18, 0x1C, 0x1E, 0x0F, 0x0F, 0x07, 0x03, 0x14, 0xE0, 0xF8, 0xFC, 0xFE, 0xFF, 0x07,
+0x03, 0x03, 0x07, 0x0F, 0xFF, 0xFE, 0xFC, 0xF8, 0xE0, 0x01, 0x07, 0x0F, 0x0F, 0x1F, 0x1C, 0x81,
+0x18, 0x01, 0x1C, 0xEF, 0x81, 0xFF, 0x04, 0x3F, 0x00, 0x0C, 0x1C, 0x1C, 0x81, 0x18, 0x07, 0x1C,
+0x1C, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x83, 0x0F, 0x83, 0x78, 0x83, 0x0F, 0x00, 0x78, 0x82,
+0xF8, 0x04, 0x0C, 0x0F, 0x0F, 0x07, 0x03, 0x0F, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0x70,
+0x38, 0x38, 0x1C, 0x1C, 0x0E, 0x0E, 0x07, 0x07, 0xC1, 0x0D, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07,
+0x0E, 0x0E, 0x1C, 0x1C, 0x38, 0x38, 0x70, 0x70, 0x8E, 0x63, 0x1F, 0x03, 0x07, 0x07, 0x0E, 0x0E,
+0x1C, 0x1C, 0x38, 0x38, 0x70, 0x70, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x60, 0x70, 0x70, 0x38, 0x38,
+0x1C, 0x1C, 0x0E, 0x0E, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x00, 0x02, 0x1E, 0x1F, 0x1F, 0x83,
+0x03, 0x05, 0x87, 0xFF, 0xFE, 0xFE, 0x7C, 0x18, 0xC2, 0x07, 0x60, 0x78, 0x7C, 0x7E, 0x7F, 0x07,
+0x03, 0x01, 0xC5, 0x83, 0x1C, 0xC5, 0x10, 0x00, 0xE0, 0xF8, 0xFC, 0x7E, 0x1E, 0x8F, 0xC7, 0xE3,
+0xF3, 0x73, 0x37, 0x7F, 0xFE, 0xFE, 0xF8, 0x3F, 0x81, 0xFF, 0x01, 0x80, 0x00, 0x81, 0xFF, 0x03,
+0xC1, 0xC0, 0xF0, 0xFE, 0x81, 0xFF, 0x07, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x0E, 0x1C, 0x1D, 0x81,
+0x19, 0x04, 0x1D, 0x1C, 0x0D, 0x01, 0x01, 0xC3, 0x09, 0xE0, 0xFC, 0xFF, 0x7F, 0x1F, 0xFF, 0xFF,
+0xFC, 0xE0, 0x80, 0xC1, 0x06, 0x80, 0xE0, 0xFC, 0xFF, 0x7F, 0x1F, 0x1B, 0x81, 0x18, 0x05, 0x1F,
+0x3F, 0xFF, 0xFF, 0xFC, 0xF0, 0x82, 0x03, 0xC8, 0x81, 0x03, 0x82, 0xFF, 0x81, 0x03, 0x06, 0x83,
+0xC7, 0xFF, 0xFF, 0xFE, 0x7C, 0x00, 0x82, 0xFF, 0x81, 0x03, 0x06, 0x07, 0x07, 0x9F, 0xFE, 0xFC,
+0xFC, 0xF8, 0x89, 0x03, 0x02, 0x01, 0x01, 0x00, 0x07, 0xE0, 0xF8, 0xFC, 0xFC, 0x3E, 0x0E, 0x07,
+0x07, 0x82, 0x03, 0x81, 0x07, 0x07, 0x1F, 0x7F, 0xFF, 0xFF, 0xF8, 0xE0, 0xC0, 0x80, 0xC4, 0x01,
+0x80, 0x80, 0xC3, 0x01, 0x01, 0x01, 0x87, 0x03, 0x82, 0xFF, 0x82, 0x03, 0x06, 0x07, 0x07, 0x1F,
+0xFE, 0xFE, 0xFC, 0xF8, 0x82, 0xFF, 0xC3, 0x02, 0x80, 0x80, 0xE0, 0x81, 0xFF, 0x00, 0x3F, 0x88,
+0x03, 0x01, 0x01, 0x01, 0xC2, 0x83, 0xFF, 0x87, 0x03, 0x83, 0xFF, 0x86, 0x03, 0x00, 0x00, 0x8C,
+0x03, 0x82, 0xFF, 0x87, 0x03, 0x82, 0xFF, 0x8B, 0x03, 0xC8, 0x08, 0x80, 0xF0, 0xF8, 0xFC, 0xFE,
+0x3E, 0x0F, 0x07, 0x07, 0x82, 0x03, 0x0B, 0x07, 0x07, 0x06, 0x07, 0x3F, 0x7F, 0xFF, 0xFF, 0xF0,
+0xC0, 0x80, 0x80, 0x81, 0x06, 0x82, 0xFE, 0xC3, 0x01, 0x01, 0x01, 0x87, 0x03, 0x00, 0x01, 0x83,
+0xFF, 0xC4, 0x88, 0xFF, 0x83, 0x03, 0x83, 0xFF, 0x83, 0x03, 0xC4, 0x83, 0x03, 0x82, 0x03, 0x83,
+0xFF, 0x83, 0x03, 0xC3, 0x83, 0xFF, 0xC4, 0x8C, 0x03, 0x00, 0x00, 0x84, 0x03, 0x83, 0xFF, 0x81,
+0x80, 0xC2, 0x00, 0x80, 0x82, 0xFF, 0x00, 0x1F, 0x86, 0x03, 0x01, 0x01, 0x01, 0xC1, 0x82, 0xFF,
+0x09, 0xC0, 0xE0, 0xF0, 0xF8, 0x7C, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x82, 0xFF, 0x09, 0x07, 0x0F,
+0x1F, 0x7E, 0xFC, 0xF8, 0xE0, 0xC0, 0x80, 0x00, 0x82, 0x03, 0xC4, 0x00, 0x01, 0x82, 0x03, 0x83,
+0xFF, 0xC8, 0x83, 0xFF, 0xC8, 0x8C, 0x03, 0x83, 0xFF, 0x07, 0xFE, 0xF8, 0xC0, 0x00, 0xC0, 0xF8,
+0xFF, 0x7F, 0x85, 0xFF, 0x08, 0x01, 0x07, 0x3F, 0x3F, 0x3E, 0x3F, 0x1F, 0x03, 0x00, 0x81, 0xFF,
+0x82, 0x03, 0xC8, 0x81, 0x03, 0x83, 0xFF, 0x03, 0xFC, 0xF8, 0xE0, 0x80, 0xC1, 0x86, 0xFF, 0x06,
+0x00, 0x01, 0x07, 0x1F, 0x3F, 0xFF, 0xFC, 0x82, 0xFF, 0x82, 0x03, 0xC5, 0x83, 0x03, 0x06, 0xC0,
+0xF8, 0xFC, 0xFE, 0xFE, 0x0F, 0x07, 0x81, 0x03, 0x07, 0x07, 0x0F, 0xFE, 0xFE, 0xFC, 0xF8, 0x0F,
+0x7F, 0x81, 0xFF, 0x01, 0xC0, 0x80, 0xC2, 0x01, 0x80, 0xC0, 0x81, 0xFF, 0x00, 0x7F, 0xC2, 0x01,
+0x01, 0x01, 0x85, 0x03, 0x01, 0x01, 0x01, 0xC1, 0x83, 0xFF, 0x82, 0x03, 0x04, 0x87, 0xFF, 0xFF,
+0xFE, 0xFE, 0x83, 0xFF, 0x81, 0x06, 0x05, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x83, 0x03, 0xC8,
+0x06, 0xC0, 0xF8, 0xFC, 0xFE, 0xFE, 0x0F, 0x07, 0x81, 0x03, 0x07, 0x07, 0x0F, 0xFE, 0xFE, 0xFC,
+0xF8, 0x0F, 0x7F, 0x81, 0xFF, 0x01, 0xC0, 0x80, 0xC2, 0x01, 0x80, 0xC0, 0x81, 0xFF, 0x00, 0x7F,
+0xC2, 0x01, 0x01, 0x01, 0x82, 0x03, 0x06, 0x07, 0x0F, 0x0F, 0x1F, 0x1D, 0x38, 0x38, 0x82, 0xFF,
+0x81, 0x03, 0x06, 0x07, 0xCF, 0xFF, 0xFE, 0xFE, 0x7C, 0x00, 0x82, 0xFF, 0x09, 0x06, 0x0E, 0x1F,
+0x3F, 0x7F, 0xFB, 0xF1, 0xE1, 0xC0, 0x00, 0x82, 0x03, 0xC4, 0x00, 0x01, 0x82, 0x03, 0x04, 0x7C,
+0xFE, 0xFE, 0xFF, 0xC7, 0x81, 0x83, 0x09, 0x03, 0x03, 0x07, 0x07, 0x06, 0x00, 0xC0, 0x80, 0x81,
+0x81, 0x81, 0x03, 0x07, 0x07, 0x87, 0xCF, 0xFF, 0xFE, 0xFE, 0x7C, 0x01, 0x87, 0x03, 0x01, 0x01,
+0x01, 0xC1, 0x84, 0x03, 0x83, 0xFF, 0x83, 0x03, 0xC5, 0x83, 0xFF, 0xCA, 0x83, 0x03, 0xC4, 0x83,
+0xFF, 0xC5, 0x82, 0xFF, 0x00, 0x1F, 0x82, 0xFF, 0x00, 0x80, 0xC2, 0x01, 0x80, 0xE0, 0x81, 0xFF,
+0x00, 0x1F, 0xC1, 0x01, 0x01, 0x01, 0x85, 0x03, 0x01, 0x01, 0x01, 0xC1, 0x06, 0x07, 0x1F, 0xFF,
+0xFF, 0xFC, 0xF0, 0x80, 0xC3, 0x04, 0xE0, 0xF8, 0xFF, 0xFF, 0x1F, 0xC2, 0x0A, 0x07, 0x1F, 0xFF,
+0xFF, 0xFE, 0xF0, 0xFC, 0xFF, 0xFF, 0x1F, 0x03, 0xC7, 0x83, 0x03, 0xC4, 0x03, 0x7F, 0xFF, 0xFF,
+0xFE, 0xC1, 0x83, 0xF0, 0xC1, 0x04, 0xF8, 0xFF, 0xFF, 0x00, 0x3F, 0x81, 0xFF, 0x0A, 0xFE, 0xFF,
+0x7F, 0x07, 0x7F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x1F, 0xC1, 0x83, 0x03, 0xC2, 0x83, 0x03, 0x00,
+0x00, 0x20, 0x01, 0x03, 0x0F, 0x1F, 0x3F, 0xFE, 0xFC, 0xF0, 0xE0, 0xE0, 0xF8, 0x7C, 0x3E, 0x1F,
+0x0F, 0x03, 0x00, 0x80, 0xC0, 0xE0, 0xF8, 0x7C, 0x3F, 0x1F, 0x0F, 0x3F, 0x7F, 0xFC, 0xF8, 0xF0,
+0xC0, 0x80, 0x02, 0x81, 0x03, 0x00, 0x01, 0xC6, 0x82, 0x03, 0x0F, 0x01, 0x07, 0x1F, 0x3F, 0xFF,
+0xFC, 0xF0, 0xE0, 0x80, 0xC0, 0xE0, 0xF8, 0xFC, 0x3F, 0x1F, 0x07, 0xC4, 0x00, 0x01, 0x83, 0xFF,
+0x00, 0x01, 0xC9, 0x83, 0x03, 0xC4, 0x85, 0x03, 0x11, 0xC3, 0xE3, 0xF3, 0xFB, 0x7F, 0x3F, 0x1F,
+0x0F, 0x80, 0xC0, 0xE0, 0xF8, 0xFC, 0x7E, 0x1F, 0x0F, 0x07, 0x03, 0xC4, 0x8D, 0x03, 0x82, 0xFF,
+0x85, 0x01, 0x82, 0xFF, 0xC6, 0x82, 0xFF, 0x85, 0x80, 0x89, 0x01, 0x06, 0x03, 0x0F, 0x3F, 0xFF,
+0xFC, 0xF0, 0xC0, 0xCB, 0x06, 0x03, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0, 0xC0, 0xCB, 0x06, 0x03, 0x0F,
+0x3F, 0xFF, 0xFC, 0xF0, 0xC0, 0xCB, 0x81, 0x01, 0x85, 0x01, 0x82, 0xFF, 0xC6, 0x82, 0xFF, 0x85,
+0x80, 0x82, 0xFF, 0x89, 0x01, 0xC3, 0x07, 0xE0, 0xF8, 0xFE, 0x7F, 0xFF, 0xF8, 0xE0, 0x80, 0xC2,
+0x0E, 0x80, 0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x03, 0x00, 0x01, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0, 0xC0,
+0x82, 0x01, 0xC7, 0x81, 0x01, 0x8E, 0x03, 0x82, 0x01, 0x04, 0x00, 0x06, 0x86, 0x87, 0xC7, 0x81,
+0xC3, 0x00, 0xC7, 0x81, 0xFF, 0x0D, 0xFE, 0xF8, 0x00, 0x1E, 0x3F, 0x7F, 0x7F, 0x7B, 0x61, 0x60,
+0x60, 0x70, 0x3F, 0x3F, 0x81, 0x7F, 0x00, 0x60, 0x82, 0xFF, 0x00, 0x80, 0x84, 0xC0, 0x02, 0x80,
+0x80, 0x00, 0x82, 0xFF, 0x01, 0x03, 0x01, 0xC1, 0x01, 0x01, 0x03, 0x81, 0xFF, 0x00, 0xFE, 0x81,
+0x1F, 0x0A, 0x0F, 0x1C, 0x1C, 0x18, 0x18, 0x1C, 0x1F, 0x0F, 0x0F, 0x07, 0x01, 0x07, 0xC0, 0xF8,
+0xFC, 0xFE, 0xFE, 0x1F, 0x07, 0x07, 0x82, 0x03, 0x0A, 0x07, 0x07, 0x06, 0x01, 0x0F, 0x1F, 0x3F,
+0x3F, 0x7C, 0x70, 0x70, 0x82, 0x60, 0x02, 0x70, 0x70, 0x30, 0xC1, 0x01, 0x80, 0x80, 0x84, 0xC0,
+0x83, 0xFF, 0x00, 0xFC, 0x81, 0xFF, 0x01, 0x9F, 0x01, 0xC2, 0x00, 0x01, 0x83, 0xFF, 0x09, 0x01,
+0x07, 0x0F, 0x1F, 0x1F, 0x1C, 0x18, 0x18, 0x1C, 0x0E, 0x83, 0x1F, 0x15, 0xE0, 0xF8, 0xFC, 0xFE,
+0xFE, 0xCF, 0xC7, 0xC3, 0xC3, 0xC7, 0xFF, 0xFF, 0xFE, 0xFC, 0xF0, 0x03, 0x0F, 0x1F, 0x3F, 0x3F,
+0x78, 0x70, 0x83, 0x60, 0x02, 0x70, 0x70, 0x30, 0x82, 0xC0, 0x01, 0xF8, 0xFE, 0x81, 0xFF, 0x00,
+0xC3, 0x82, 0xC1, 0x00, 0xC3, 0xC3, 0x83, 0xFF, 0xC9, 0x83, 0x1F, 0xC5, 0x0A, 0xF0, 0xFC, 0xFE,
+0xFE, 0x3F, 0x07, 0x03, 0x03, 0x07, 0x07, 0xFE, 0x82, 0xFF, 0x09, 0x07, 0x1F, 0x3F, 0x7F, 0x7E,
+0x70, 0x60, 0x60, 0x70, 0x38, 0x82, 0xFF, 0x01, 0x7F, 0x00, 0x81, 0x0C, 0x82, 0x08, 0x06, 0x0C,
+0x0C, 0x0F, 0x0F, 0x07, 0x03, 0x00, 0x82, 0xFF, 0x00, 0x80, 0x85, 0xC0, 0x01, 0x80, 0x00, 0x82,
+0xFF, 0x02, 0x07, 0x03, 0x01, 0xC1, 0x82, 0xFF, 0x00, 0xFE, 0x82, 0x1F, 0xC4, 0x83, 0x1F, 0x84,
+0xC0, 0x82, 0xC3, 0x00, 0x03, 0xC5, 0x82, 0xFF, 0xC6, 0x82, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x84,
+0xC0, 0x83, 0xC3, 0xC6, 0x83, 0xFF, 0xC6, 0x82, 0xFF, 0x00, 0x7F, 0x81, 0x03, 0x81, 0x02, 0x82,
+0x03, 0x01, 0x01, 0x00, 0x82, 0xFF, 0xC3, 0x00, 0x80, 0x82, 0xC0, 0x00, 0x40, 0x82, 0xFF, 0x07,
+0x70, 0xFC, 0xFE, 0xFF, 0xCF, 0x87, 0x03, 0x01, 0xC1, 0x82, 0x1F, 0xC1, 0x07, 0x01, 0x03, 0x07,
+0x1F, 0x1F, 0x1E, 0x1C, 0x18, 0x84, 0x01, 0x83, 0xFF, 0xC5, 0x83, 0xFF, 0xC5, 0x83, 0x1F, 0x82,
+0xFF, 0x0B, 0x3E, 0x0F, 0x1F, 0xFF, 0xFF, 0xFE, 0x3E, 0x0F, 0x0F, 0xFF, 0xFF, 0xFE, 0x82, 0x7F,
+0xC2, 0x81, 0x7F, 0xC2, 0x81, 0x7F, 0x82, 0xFF, 0x04, 0x1E, 0x0F, 0x07, 0x03, 0x03, 0x81, 0xFF,
+0x01, 0xFE, 0xF8, 0x82, 0x7F, 0xC4, 0x83, 0x7F, 0x05, 0xF0, 0xFC, 0xFE, 0xFE, 0x1F, 0x07, 0x81,
+0x03, 0x0B, 0x07, 0x1F, 0xFE, 0xFE, 0xFC, 0xF8, 0x07, 0x1F, 0x3F, 0x3F, 0x7C, 0x70, 0x81, 0x60,
+0x05, 0x70, 0x7C, 0x3F, 0x3F, 0x1F, 0x0F, 0x82, 0xFF, 0x09, 0x0E, 0x07, 0x03, 0x03, 0x07, 0x0F,
+0xFF, 0xFE, 0xFE, 0xF8, 0x82, 0xFF, 0x09, 0x78, 0x70, 0x60, 0x60, 0x70, 0x7C, 0x7F, 0x3F, 0x1F,
+0x07, 0x82, 0x0F, 0xC9, 0x0A, 0xF0, 0xFC, 0xFE, 0xFE, 0x1F, 0x07, 0x03, 0x03, 0x07, 0x07, 0xFE,
+0x81, 0xFF, 0x09, 0x0F, 0x1F, 0x3F, 0x7F, 0x7C, 0x70, 0x60, 0x60, 0x70, 0x38, 0x82, 0xFF, 0xC9,
+0x82, 0x0F, 0x83, 0xFF, 0x04, 0x1E, 0x0F, 0x07, 0x03, 0x03, 0x81, 0x1F, 0x83, 0x7F, 0xC7, 0x05,
+0x38, 0x7E, 0x7E, 0xFF, 0xFF, 0xE3, 0x81, 0xC3, 0x04, 0x83, 0x87, 0x87, 0x06, 0x30, 0x81, 0x70,
+0x08, 0x60, 0x60, 0x61, 0x61, 0x73, 0x7F, 0x3F, 0x3F, 0x1F, 0x82, 0x18, 0x82, 0xFF, 0x85, 0x18,
+0xC3, 0x82, 0xFF, 0x00, 0x80, 0xCA, 0x00, 0x01, 0x87, 0x03, 0x82, 0xFF, 0xC4, 0x82, 0xFF, 0x08,
+0x1F, 0x3F, 0x7F, 0x7F, 0x70, 0x60, 0x70, 0x78, 0x3C, 0x82, 0x7F, 0x06, 0x01, 0x07, 0x3F, 0xFF,
+0xFE, 0xF8, 0xE0, 0xC2, 0x05, 0xC0, 0xF8, 0xFE, 0xFF, 0x3F, 0x07, 0xC3, 0x08, 0x07, 0x1F, 0x7F,
+0x7F, 0x7C, 0x7F, 0x7F, 0x1F, 0x03, 0xC2, 0x00, 0x3F, 0x81, 0xFF, 0x0D, 0xC0, 0xC0, 0xFC, 0xFE,
+0x7E, 0xFE, 0xFE, 0xF0, 0x00, 0xF8, 0xFF, 0xFF, 0x00, 0x07, 0x83, 0x7F, 0x02, 0x07, 0x00, 0x07,
+0x83, 0x7F, 0x00, 0x07, 0x1D, 0x01, 0x07, 0x0F, 0x1F, 0x7F, 0xFE, 0xF8, 0xF0, 0xF0, 0xFC, 0x7E,
+0x1F, 0x0F, 0x03, 0x01, 0x40, 0x70, 0x78, 0x7C, 0x3F, 0x1F, 0x07, 0x07, 0x0F, 0x1F, 0x7F, 0x7E,
+0x78, 0x70, 0x60, 0x07, 0x01, 0x07, 0x1F, 0xFF, 0xFF, 0xFC, 0xE0, 0x80, 0xC1, 0x05, 0xE0, 0xF8,
+0xFE, 0xFF, 0x1F, 0x07, 0xC3, 0x08, 0x03, 0x0F, 0xFF, 0xFF, 0xFE, 0xFF, 0x3F, 0x0F, 0x03, 0xC3,
+0x81, 0x08, 0x05, 0x0C, 0x0E, 0x0F, 0x0F, 0x07, 0x01, 0xC5, 0x00, 0x00, 0x82, 0x03, 0x12, 0x83,
+0xC3, 0xE3, 0xF3, 0xFB, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x60, 0x70, 0x7C, 0x7E, 0x7F, 0x6F, 0x67,
+0x63, 0x61, 0x84, 0x60, 0xC3, 0x00, 0x3E, 0x81, 0xFF, 0x00, 0xC3, 0x82, 0x01, 0x82, 0x18, 0x04,
+0x3C, 0xFF, 0xFF, 0xE7, 0x81, 0xC7, 0x00, 0x7C, 0x81, 0xFF, 0x00, 0xC3, 0x82, 0x80, 0xC6, 0x84,
+0x01, 0x87, 0xFF, 0x81, 0x01, 0x82, 0x01, 0x00, 0x83, 0x81, 0xFF, 0x00, 0x3E, 0xC7, 0x04, 0x81,
+0xE7, 0xFF, 0xFF, 0x3C, 0x82, 0x18, 0x82, 0x80, 0x00, 0xC1, 0x81, 0xFF, 0x00, 0x7C, 0xC3, 0x84,
+0x01, 0xC6, 0x0F, 0x18, 0x1E, 0x1F, 0x1F, 0x03, 0x03, 0x07, 0x0F, 0x0E, 0x1E, 0x1C, 0x18, 0x18,
+0x1F, 0x1F, 0x0F,
+};
+
+static const SSD1309_Glyph_t FontProp_16x26Glyphs [] = {
+    {    0,  0,  0,  0,  0,  8},  // sp
+    {    0,  5, 21,  0,  0,  7},  // !
+    {   10, 11,  7,  0,  0, 13},  // "
+    {   15, 16, 21,  0,  0, 18},  // #
+    {   60, 13, 23,  0,  0, 15},  // $
+    {   98, 16, 21,  0,  0, 18},  // %
+    {  147, 16, 21,  0,  0, 18},  // &
+    {  193,  5,  7,  0,  0,  7},  // '
+    {  199, 12, 25,  0,  0, 14},  // (
+    {  232, 12, 25,  0,  0, 14},  // )
+    {  265, 14, 12,  0,  0, 16},  // *
+    {  292, 16, 15,  0,  6, 18},  // +
+    {  304,  5,  9,  0, 17,  7},  // ,
+    {  313, 13,  2,  0, 11, 15},  // -
+    {  315,  5,  4,  0, 17,  7},  // .
+    {  317, 16, 25,  0,  0, 18},  // /
+    {  348, 15, 21,  0,  0, 17},  // 0
+    {  389, 14, 21,  0,  0, 16},  // 1
+    {  407, 13, 21,  0,  0, 15},  // 2
+    {  441, 12, 21,  0,  0, 14},  // 3
+    {  476, 16, 21,  0,  0, 18},  // 4
+    {  504, 12, 21,  0,  0, 14},  // 5
+    {  531, 15, 21,  0,  0, 17},  // 6
+    {  576, 14, 21,  0,  0, 16},  // 7
+    {  603, 15, 21,  0,  0, 17},  // 8
+    {  649, 15, 21,  0,  0, 17},  // 9
+    {  695,  5, 15,  0,  6,  7},  // :
+    {  699,  5, 20,  0,  6,  7},  // ;
+    {  711, 16, 15,  0,  6, 18},  // <
+    {  744, 16,  7,  0, 10, 18},  // =
+    {  746, 16, 15,  0,  6, 18},  // >
+    {  779, 14, 21,  0,  0, 16},  // ?
+    {  806, 16, 21,  0,  0, 18},  // @
+    {  855, 16, 18,  0,  3, 18},  // A
+    {  890, 14, 18,  0,  3, 16},  // B
+    {  920, 15, 18,  0,  3, 17},  // C
+    {  952, 15, 18,  0,  3, 17},  // D
+    {  981, 14, 18,  0,  3, 16},  // E
+    {  993, 13, 18,  0,  3, 15},  // F
+    { 1002, 16, 18,  0,  3, 18},  // G
+    { 1039, 15, 18,  0,  3, 17},  // H
+    { 1053, 14, 18,  0,  3, 16},  // I
+    { 1065, 12, 18,  0,  3, 14},  // J
+    { 1086, 14, 18,  0,  3, 16},  // K
+    { 1119, 14, 18,  0,  3, 16},  // L
+    { 1127, 16, 18,  0,  3, 18},  // M
+    { 1157, 15, 18,  0,  3, 17},  // N
+    { 1182, 16, 18,  0,  3, 18},  // O
+    { 1224, 14, 18,  0,  3, 16},  // P
+    { 1248, 16, 22,  0,  3, 18},  // Q
+    { 1294, 14, 18,  0,  3, 16},  // R
+    { 1326, 14, 18,  0,  3, 16},  // S
+    { 1362, 16, 18,  0,  3, 18},  // T
+    { 1375, 15, 18,  0,  3, 17},  // U
+    { 1404, 16, 18,  0,  3, 18},  // V
+    { 1436, 16, 18,  0,  3, 18},  // W
+    { 1473, 16, 18,  0,  3, 18},  // X
+    { 1514, 16, 18,  0,  3, 18},  // Y
+    { 1542, 15, 18,  0,  3, 17},  // Z
+    { 1566, 11, 25,  0,  0, 13},  // [
+    { 1579, 15, 25,  0,  0, 17},  /* \ */
+    { 1608, 11, 25,  0,  0, 13},  // ]
+    { 1621, 15, 17,  0,  0, 17},  // ^
+    { 1653, 16,  2,  0, 21, 18},  // _
+    { 1655,  4,  1,  0,  0,  6},  // `
+    { 1657, 15, 15,  0,  6, 17},  // a
+    { 1688, 14, 21,  0,  0, 16},  // b
+    { 1725, 15, 15,  0,  6, 17},  // c
+    { 1754, 15, 21,  0,  0, 17},  // d
+    { 1787, 15, 15,  0,  6, 17},  // e
+    { 1816, 15, 21,  0,  0, 17},  // f
+    { 1836, 15, 20,  0,  6, 17},  // g
+    { 1878, 14, 21,  0,  0, 16},  // h
+    { 1903, 11, 21,  0,  0, 13},  // i
+    { 1917, 12, 26,  0,  0, 14},  // j
+    { 1940, 14, 21,  0,  0, 16},  // k
+    { 1973, 11, 21,  0,  0, 13},  // l
+    { 1983, 16, 15,  0,  6, 18},  // m
+    { 2006, 14, 15,  0,  6, 16},  // n
+    { 2024, 15, 15,  0,  6, 17},  // o
+    { 2055, 14, 20,  0,  6, 16},  // p
+    { 2084, 14, 20,  0,  6, 16},  // q
+    { 2114, 13, 15,  0,  6, 15},  // r
+    { 2127, 13, 15,  0,  6, 15},  // s
+    { 2154, 15, 18,  0,  3, 17},  // t
+    { 2170, 13, 15,  0,  6, 15},  // u
+    { 2187, 16, 15,  0,  6, 18},  // v
+    { 2215, 16, 15,  0,  6, 18},  // w
+    { 2244, 15, 15,  0,  6, 17},  // x
+    { 2275, 16, 20,  0,  6, 18},  // y
+    { 2314, 15, 15,  0,  6, 17},  // z
+    { 2340, 13, 25,  0,  0, 15},  // {
+    { 2369,  3, 25,  0,  0,  5},  // |
+    { 2373, 13, 25,  0,  0, 15},  // }
+    { 2402, 16,  5,  0, 11, 18},  // ~
+};
+
+const SSD1309_Font_t FontProp_16x26 = {26, 0x0020, 95, FontProp_16x26Glyphs, FontProp_16x26Bitmaps, NULL};
+#endif
+
+#endif /* __SSD1309_FONTS_PROP_H__ */
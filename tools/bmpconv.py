@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+"""Convert row-major bitmaps to the page-major SSD1309_Bitmap_t of ssd1309.h.
+
+ssd1309_DrawBitmap takes rows of (width + 7) / 8 bytes, bit 7 the leftmost
+pixel, as made by LCD Assistant and most converters. The display RAM is
+column-per-byte instead, so ssd1309_DrawPageBitmap takes (height + 7) / 8
+bands of width bytes, bit 0 the top row of the band.
+
+Sources are C arrays, sized by their name (garfield_128x64) or by :WxH,
+or binary PBM (P4) files:
+
+    bmpconv.py OUTPUT [--invert] [--rle] [--mask] SOURCE=NAME ...
+
+    bmpconv.py example/example_bitmaps.h example/example.c:github_logo_64x64=github_logo_64x64_page \
+        --invert example/example.c:garfield_128x64=garfield_128x64_page \
+        --rle example/example.c:garfield_128x64=garfield_128x64_rle
+    bmpconv.py splash.c splash.pbm=splash
+
+--invert swaps set and clear pixels of the following sources, --mask
+takes the set pixels of the next source as the mask of the one after it.
+--rle makes the following sources SSD1309_Image_t, run-length coded like
+the fonts of tools/fontgen.py, for ssd1309_StreamImage.
+OUTPUT ending in .h gets an include guard and static definitions, in .c
+an include of ssd1309.h.
+"""
+
+import os
+import re
+import sys
+
+from fontgen import rle_decode, rle_encode
+
+
+def c_array(path, array):
+    """Bytes and (width, height) of a const unsigned char array of a C source."""
+    name, _, size = array.partition(":")
+    with open(path) as f:
+        text = f.read()
+    match = re.search(r"\b%s\s*\[\s*\]\s*=\s*\{(.*?)\};" % re.escape(name), text, re.S)
+    if match is None:
+        sys.exit("%s: no array %s" % (path, name))
+    body = re.sub(r"/\*.*?\*/|//[^\n]*", "", match.group(1), flags=re.S)
+    data = [int(value, 0) for value in re.findall(r"0[xX][0-9A-Fa-f]+|\d+", body)]
+    if not size:
+        match = re.search(r"(\d+x\d+)$", name)
+        if match is None:
+            sys.exit("%s: size of %s unknown, use %s:WxH" % (path, name, name))
+        size = match.group(1)
+    width, height = [int(v) for v in size.split("x")]
+    return data, width, height
+
+
+def pbm(path):
+    """Bytes and (width, height) of a binary PBM, set bits black."""
+    with open(path, "rb") as f:
+        raw = f.read()
+    fields = re.match(rb"P4\s+(?:#[^\n]*\n\s*)*(\d+)\s+(\d+)\s", raw)
+    if fields is None:
+        sys.exit("%s: not a binary PBM" % path)
+    width, height = int(fields.group(1)), int(fields.group(2))
+    return list(raw[fields.end():]), width, height
+
+
+def pixels(data, width, height, invert):
+    """Rows of pixels of row-major bytes, bit 7 the leftmost."""
+    stride = (width + 7) // 8
+    if len(data) < stride * height:
+        sys.exit("%d bytes, %dx%d needs %d" % (len(data), width, height, stride * height))
+    return [[((data[row * stride + column // 8] >> (7 - column % 8)) & 1) ^ invert for column in range(width)]
+            for row in range(height)]
+
+
+def page_bytes(rows, width, height):
+    """Bands of column bytes, bit 0 the top row of a band."""
+    data = []
+    for band in range((height + 7) // 8):
+        for column in range(width):
+            byte = 0
+            for bit in range(8):
+                row = band * 8 + bit
+                if row < height and rows[row][column]:
+                    byte |= 1 << bit
+            data.append(byte)
+    return data
+
+
+def emit_array(name, data, storage):
+    out = ["%sconst uint8_t %s [] = {" % (storage, name)]
+    for i in range(0, len(data), 16):
+        out.append("    " + ", ".join("0x%02X" % byte for byte in data[i:i + 16]) + ",")
+    out.append("};")
+    return out
+
+
+def load(spec, invert):
+    if ":" in spec and not spec.endswith(".pbm"):
+        path, array = spec.split(":", 1)
+        data, width, height = c_array(path, array)
+    else:
+        data, width, height = pbm(spec)
+    if not (0 < width < 256 and 0 < height < 256):
+        sys.exit("%s: %dx%d, at most 255x255" % (spec, width, height))
+    return width, height, page_bytes(pixels(data, width, height, invert), width, height)
+
+
+def main(argv):
+    if len(argv) < 3:
+        sys.exit(__doc__)
+    output = argv[1]
+
+    header = output.endswith(".h")
+    storage = "static " if header else ""
+    out = ["/* Generated by tools/bmpconv.py, do not edit */", ""]
+    if header:
+        guard = "__%s__" % re.sub(r"\W", "_", os.path.basename(output)).upper()
+        out.extend(["#ifndef " + guard, "#define " + guard])
+    else:
+        out.append('#include "ssd1309.h"')
+
+    invert = 0
+    rle = False
+    mask = None
+    take_mask = False
+    for item in argv[2:]:
+        if item == "--invert":
+            invert = 1
+            continue
+        if item == "--rle":
+            rle = True
+            continue
+        if item == "--mask":
+            take_mask = True
+            continue
+        source, name = item.rsplit("=", 1)
+        width, height, data = load(source, invert)
+        if take_mask:
+            mask = (name, width, height, data)
+            take_mask = False
+            continue
+
+        out.append("")
+        if rle:
+            packed = rle_encode(data)
+            assert rle_decode(packed, len(data)) == data
+            out.append("/* %s: %dx%d, %d bytes run-length coded from %d%s */" % (name, width, height, len(packed),
+                                                                             len(data), ", inverted" if invert else ""))
+            out.extend(emit_array(name + "Data", packed, storage))
+            out.append("%sconst SSD1309_Image_t %s = {%d, %d, %sData};" % (storage, name, width, height, name))
+            continue
+        out.append("/* %s: %dx%d, %d bands of %d columns%s */" % (name, width, height, (height + 7) // 8, width,
+                                                               ", inverted" if invert else ""))
+        out.extend(emit_array(name + "Data", data, storage))
+        mask_name = "NULL"
+        if mask is not None:
+            if mask[1:3] != (width, height):
+                sys.exit("%s: mask %s is %dx%d" % (name, mask[0], mask[1], mask[2]))
+            mask_name = mask[0] + "Data"
+            out.extend(emit_array(mask_name, mask[3], storage))
+            mask = None
+        out.append("%sconst SSD1309_Bitmap_t %s = {%d, %d, %sData, %s};" % (storage, name, width, height, name,
+                                                                          mask_name))
+
+    if header:
+        out.extend(["", "#endif /* %s */" % guard])
+
+    with open(output, "w") as f:
+        f.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    main(sys.argv)
@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+"""Convert the row-major fonts of ssd1309_fonts.c to the page-major layout.
+
+The tables in ssd1309_fonts.c hold one uint16_t per glyph row, bit 15 the
+leftmost pixel. The display RAM is column-per-byte instead, so every glyph
+is rewritten as (height + 7) / 8 bands of width bytes, bit 0 the top row of
+the band, which the driver copies into the screenbuffer a byte per column.
+
+Usage: fontconv.py [ssd1309_fonts.c] [ssd1309_fonts_page.h]
+"""
+
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SOURCE = os.path.join(HERE, "..", "ssd1309", "ssd1309_fonts.c")
+OUTPUT = os.path.join(HERE, "..", "ssd1309", "ssd1309_fonts_page.h")
+
+FIRST_CHAR = 32
+LAST_CHAR = 126
+
+
+def parse_fonts(text):
+    """Yield (table name, size, width, height, rows) for every FontDef of the source."""
+    tables = {}
+    for match in re.finditer(r"static const uint16_t (\w+)\s*\[\]\s*=\s*\{(.*?)\};", text, re.S):
+        body = re.sub(r"//[^\n]*", "", match.group(2))
+        tables[match.group(1)] = [int(value, 16) for value in re.findall(r"0x[0-9A-Fa-f]+", body)]
+
+    for match in re.finditer(r"FontDef\s+Font_(\w+)\s*=\s*\{\s*\w+,\s*(\d+),\s*(\d+),\s*(\w+)", text):
+        size, width, height, name = match.group(1), int(match.group(2)), int(match.group(3)), match.group(4)
+        rows = tables[name]
+        count = LAST_CHAR - FIRST_CHAR + 1
+        if len(rows) != count * height:
+            sys.exit("%s: %d rows, expected %d" % (name, len(rows), count * height))
+        yield name, size, width, height, rows
+
+
+def page_glyph(rows, width, height):
+    """Bands of column bytes of one glyph, bit 0 the top row of each band."""
+    data = []
+    for band in range((height + 7) // 8):
+        for column in range(width):
+            byte = 0
+            for bit in range(8):
+                row = band * 8 + bit
+                if row < height and (rows[row] >> (15 - column)) & 1:
+                    byte |= 1 << bit
+            data.append(byte)
+    return data
+
+
+def char_comment(code):
+    if code == FIRST_CHAR:
+        return "// sp"
+    if chr(code) == "\\":
+        # A backslash ending a // comment would continue it on the next line
+        return "/* \\ */"
+    return "// " + chr(code)
+
+
+def convert(text):
+    out = []
+    out.append("/* Generated by tools/fontconv.py from ssd1309_fonts.c, do not edit */")
+    out.append("")
+    out.append("#ifndef __SSD1309_FONTS_PAGE_H__")
+    out.append("#define __SSD1309_FONTS_PAGE_H__")
+    for name, size, width, height, rows in parse_fonts(text):
+        bands = (height + 7) // 8
+        out.append("")
+        out.append("#if defined(SSD1309_INCLUDE_FONT_%s)" % size)
+        out.append("/* %s: %d bands of %d columns per glyph */" % (name, bands, width))
+        out.append("static const uint8_t %sPages [] = {" % name)
+        for code in range(FIRST_CHAR, LAST_CHAR + 1):
+            start = (code - FIRST_CHAR) * height
+            glyph = page_glyph(rows[start:start + height], width, height)
+            out.append(", ".join("0x%02X" % byte for byte in glyph) + ",  " + char_comment(code))
+        out.append("};")
+        out.append("#endif")
+    out.append("")
+    out.append("#endif /* __SSD1309_FONTS_PAGE_H__ */")
+    return "\n".join(out) + "\n"
+
+
+def main(argv):
+    source = argv[1] if len(argv) > 1 else SOURCE
+    output = argv[2] if len(argv) > 2 else OUTPUT
+
+    with open(source) as f:
+        text = f.read()
+    with open(output, "w") as f:
+        f.write(convert(text))
+
+
+if __name__ == "__main__":
+    main(sys.argv)
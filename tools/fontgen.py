@@ -0,0 +1,304 @@
+#!/usr/bin/env python3
+"""Generate proportional SSD1309_Font_t fonts (see ssd1309_fonts.h).
+
+Every glyph is trimmed to its inked box, stored page-major (bands of column
+bytes, bit 0 the top row of the band) and run-length coded so the driver can
+decode it straight into the screenbuffer.
+
+Fonts come from the fixed-width tables of ssd1309_fonts.c (PATH:FONT) or
+from BDF files, several sources joined with + (the first one with a glyph
+for a code point wins):
+
+    fontgen.py OUTPUT ssd1309/ssd1309_fonts.c:Font_7x10+tools/extra_7x10.bdf=FontProp_7x10 ...
+
+OUTPUT ending in .h gets an include guard, in .c an include of
+ssd1309_fonts.h, so a font can also be built as its own source file.
+
+--subset keeps only the characters of the string literals in the given
+sources (UTF-8), so flash holds just the glyphs the application draws:
+
+    fontgen.py --subset app/menu.c --subset app/strings.c app_fonts.c \
+        ssd1309/ssd1309_fonts.c:Font_7x10+tools/extra_7x10.bdf=AppFont
+
+Glyphs of consecutive code points are indexed from the first one. Any gap
+adds a sorted table of code points which the driver binary searches.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+from fontconv import FIRST_CHAR, LAST_CHAR, parse_fonts
+
+
+class Glyph:
+    """Inked box of a glyph as rows of pixels, top row first."""
+
+    def __init__(self, width, height, x_offset, y_offset, advance, pixels):
+        self.width = width
+        self.height = height
+        self.x_offset = x_offset
+        self.y_offset = y_offset
+        self.advance = advance
+        self.pixels = pixels
+
+
+def ink_box(pixels, width, height):
+    """(left, top, rows of pixels) of the inked part of pixels[row][column], None if blank."""
+    rows = [r for r in range(height) if any(pixels[r])]
+    columns = [c for c in range(width) if any(pixels[r][c] for r in range(height))]
+    if not rows:
+        return None
+    top, bottom, left, right = rows[0], rows[-1], columns[0], columns[-1]
+    return left, top, [pixels[r][left:right + 1] for r in range(top, bottom + 1)]
+
+
+def trim(pixels, width, height, gap, blank_advance):
+    """Glyph from a full cell of pixels[row][column], empty sides removed."""
+    box = ink_box(pixels, width, height)
+    if box is None:
+        return Glyph(0, 0, 0, 0, blank_advance, [])
+    left, top, rows = box
+    return Glyph(len(rows[0]), len(rows), 0, top, len(rows[0]) + gap, rows)
+
+
+def glyphs_from_table(rows, width, height):
+    """Proportional glyphs of a fixed-width table of ssd1309_fonts.c."""
+    gap = max(1, width // 8)
+    glyphs = {}
+    for code in range(FIRST_CHAR, LAST_CHAR + 1):
+        cell = rows[(code - FIRST_CHAR) * height:(code - FIRST_CHAR + 1) * height]
+        pixels = [[(row >> (15 - c)) & 1 for c in range(width)] for row in cell]
+        glyphs[code] = trim(pixels, width, height, gap, (width + 1) // 2)
+    return glyphs
+
+
+def glyphs_from_bdf(text):
+    """Line height and glyphs of a BDF font, boxes placed from FONT_ASCENT."""
+    ascent = int(re.search(r"^FONT_ASCENT\s+(-?\d+)", text, re.M).group(1))
+    descent = int(re.search(r"^FONT_DESCENT\s+(-?\d+)", text, re.M).group(1))
+    glyphs = {}
+    for char in re.finditer(r"^STARTCHAR.*?^ENDCHAR", text, re.M | re.S):
+        body = char.group(0)
+        code = int(re.search(r"^ENCODING\s+(-?\d+)", body, re.M).group(1))
+        advance = int(re.search(r"^DWIDTH\s+(-?\d+)", body, re.M).group(1))
+        width, height, x, y = [int(v) for v in re.search(r"^BBX\s+(.*)$", body, re.M).group(1).split()]
+        if not 0 <= code <= 0xFFFF:
+            continue
+        hex_rows = body.split("BITMAP")[1].split()[:height]
+        pixels = []
+        for row in hex_rows:
+            value = int(row, 16)
+            bits = len(row) * 4
+            pixels.append([(value >> (bits - 1 - c)) & 1 for c in range(width)])
+        box = ink_box(pixels, width, height)
+        if box is None:
+            glyphs[code] = Glyph(0, 0, 0, 0, advance, [])
+            continue
+        left, top, rows = box
+        glyphs[code] = Glyph(len(rows[0]), len(rows), x + left, ascent - (y + height) + top, advance, rows)
+    return ascent + descent, glyphs
+
+
+def strings_codepoints(paths):
+    """Code points of the C string literals of the source files."""
+    codes = set()
+    for path in paths:
+        with open(path, encoding="utf-8") as f:
+            text = f.read()
+        text = re.sub(r"/\*.*?\*/|//[^\n]*", "", text, flags=re.S)
+        for literal in re.finditer(r'"((?:[^"\\\n]|\\.)*)"', text):
+            value = re.sub(r"\\(x[0-9A-Fa-f]+|[0-7]{1,3}|.)", "", literal.group(1))
+            codes.update(ord(char) for char in value)
+    return codes
+
+
+def page_bytes(glyph):
+    """Bands of column bytes of the inked box, bit 0 the top row of a band."""
+    data = []
+    for band in range((glyph.height + 7) // 8):
+        for column in range(glyph.width):
+            byte = 0
+            for bit in range(8):
+                row = band * 8 + bit
+                if row < glyph.height and glyph.pixels[row][column]:
+                    byte |= 1 << bit
+            data.append(byte)
+    return data
+
+
+def rle_encode(data):
+    """Run-length code bytes as documented with SSD1309_Font_t."""
+    out = []
+    literal = []
+
+    def flush():
+        while literal:
+            chunk = literal[:128]
+            del literal[:128]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and data[i + run] == data[i]:
+            run += 1
+        if data[i] == 0 and run >= 2:
+            flush()
+            run = min(run, 64)
+            out.append(0xC0 + run - 1)
+        elif data[i] != 0 and run >= 3:
+            flush()
+            run = min(run, 65)
+            out.extend([0x80 + run - 2, data[i]])
+        else:
+            run = 1
+            literal.append(data[i])
+        i += run
+    flush()
+    return out
+
+
+def rle_decode(data, size):
+    """Inverse of rle_encode, to check it."""
+    out = []
+    i = 0
+    while len(out) < size:
+        header = data[i]
+        if header < 0x80:
+            out.extend(data[i + 1:i + 2 + header])
+            i += 2 + header
+        elif header < 0xC0:
+            out.extend([data[i + 1]] * (header - 0x80 + 2))
+            i += 2
+        else:
+            out.extend([0] * (header - 0xC0 + 1))
+            i += 1
+    return out
+
+
+def char_comment(code):
+    if code == 0x20:
+        return "// sp"
+    if code == 0x5C:
+        return "/* \\ */"
+    if code < 0x7F:
+        return "// " + chr(code)
+    return "// U+%04X %s" % (code, chr(code))
+
+
+def emit_font(name, height, glyphs, guard):
+    """C tables and SSD1309_Font_t of one font, with a code point index if there are gaps."""
+    codes = sorted(glyphs)
+    sparse = codes[-1] - codes[0] + 1 != len(codes)
+    bitmaps = []
+    entries = []
+    for code in codes:
+        glyph = glyphs[code]
+        data = page_bytes(glyph)
+        packed = rle_encode(data)
+        assert rle_decode(packed, len(data)) == data
+        entries.append((code, len(bitmaps), glyph))
+        bitmaps.extend(packed)
+
+    if len(bitmaps) > 0xFFFF:
+        sys.exit("%s: %d bytes of bitmaps, at most 65535" % (name, len(bitmaps)))
+
+    out = []
+    if guard:
+        out.append("#if defined(%s)" % guard)
+    out.append("/* %s: %d glyphs, %d bytes of bitmaps */" % (name, len(entries), len(bitmaps)))
+    out.append("static const uint8_t %sBitmaps [] = {" % name)
+    for i in range(0, len(bitmaps), 16):
+        out.append(", ".join("0x%02X" % byte for byte in bitmaps[i:i + 16]) + ",")
+    out.append("};")
+    out.append("")
+    out.append("static const SSD1309_Glyph_t %sGlyphs [] = {" % name)
+    for code, offset, glyph in entries:
+        out.append("    {%5d, %2d, %2d, %2d, %2d, %2d},  %s" % (offset, glyph.width, glyph.height, glyph.x_offset,
+                                                            glyph.y_offset, glyph.advance, char_comment(code)))
+    out.append("};")
+    out.append("")
+    if sparse:
+        out.append("static const uint16_t %sCodepoints [] = {" % name)
+        for i in range(0, len(codes), 12):
+            out.append(", ".join("0x%04X" % code for code in codes[i:i + 12]) + ",")
+        out.append("};")
+        out.append("")
+    out.append("const SSD1309_Font_t %s = {%d, 0x%04X, %d, %sGlyphs, %sBitmaps, %s};" % (
+        name, height, codes[0], len(entries), name, name, name + "Codepoints" if sparse else "NULL"))
+    if guard:
+        out.append("#endif")
+    return out
+
+
+def load(spec):
+    """Size, line height and glyphs of PATH:FONT, the FontDef FONT of a fonts source, or of PATH.bdf."""
+    if spec.endswith(".bdf"):
+        with open(spec) as f:
+            height, glyphs = glyphs_from_bdf(f.read())
+        return None, height, glyphs
+    path, font = spec.split(":")
+    with open(path) as f:
+        text = f.read()
+    for name, size, width, height, rows in parse_fonts(text):
+        if "Font_" + size == font:
+            return size, height, glyphs_from_table(rows, width, height)
+    sys.exit("%s: no FontDef %s" % (path, font))
+
+
+def load_all(sources):
+    """Size, line height and glyphs of sources joined with +, the first glyph of a code point wins."""
+    size, height, glyphs = None, None, {}
+    for spec in sources.split("+"):
+        spec_size, spec_height, spec_glyphs = load(spec)
+        if height is not None and spec_height != height:
+            sys.exit("%s: line height %d, expected %d" % (spec, spec_height, height))
+        size = size or spec_size
+        height = spec_height
+        for code, glyph in spec_glyphs.items():
+            glyphs.setdefault(code, glyph)
+    return size, height, glyphs
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("output", help="generated .h or .c file")
+    parser.add_argument("fonts", nargs="+", metavar="SOURCES=NAME", help="source fonts and name of the result")
+    parser.add_argument("--subset", action="append", metavar="SOURCE",
+                        help="keep only the characters of the string literals of SOURCE")
+    args = parser.parse_args(argv[1:])
+    wanted = strings_codepoints(args.subset) if args.subset else None
+
+    header = args.output.endswith(".h")
+    out = ["/* Generated by tools/fontgen.py, do not edit */", ""]
+    if header:
+        guard = "__%s__" % re.sub(r"\W", "_", os.path.basename(args.output)).upper()
+        out.extend(["#ifndef " + guard, "#define " + guard])
+    else:
+        out.append('#include "ssd1309_fonts.h"')
+
+    for spec in args.fonts:
+        sources, name = spec.split("=")
+        size, height, glyphs = load_all(sources)
+        if wanted is not None:
+            missing = sorted(code for code in wanted if code not in glyphs and code >= 0x20)
+            if missing:
+                sys.stderr.write("%s: no glyph for %s\n" % (name, " ".join("U+%04X" % code for code in missing)))
+            glyphs = {code: glyph for code, glyph in glyphs.items() if code in wanted}
+            if not glyphs:
+                sys.exit("%s: no glyph left" % name)
+        out.append("")
+        out.extend(emit_font(name, height, glyphs, "SSD1309_INCLUDE_FONT_" + size if header and size else None))
+
+    if header:
+        out.extend(["", "#endif /* %s */" % guard])
+
+    with open(args.output, "w") as f:
+        f.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    main(sys.argv)